@@ -6,6 +6,7 @@
 // http://dx.doi.org/10.1016/j.jcp.2016.02.003
 
 #include <chrono>
+#include <cstdint>
 #include <fstream>
 #include <string>
 #include <utility>
@@ -13,12 +14,13 @@
 #include <nanobench.h>
 
 template<typename F>
-inline auto create_benchmark(const std::string& name, F&& func)
+inline auto create_benchmark(const std::string& name, F&& func,
+                             const std::uint64_t min_epoch_iterations = 25'000)
     -> ankerl::nanobench::Bench {
   auto log = std::ofstream{name + ".json"};
   return ankerl::nanobench::Bench()
       .title(name)
-      .minEpochIterations(25'000)
+      .minEpochIterations(min_epoch_iterations)
       .run(name, std::forward<F>(func))
       .render(ankerl::nanobench::templates::pyperf(), log);
 }
@@ -0,0 +1,86 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "overlap/overlap.hpp"
+
+#include "common.hpp"
+
+TEST_SUITE("CompactElements") {
+  using namespace overlap;
+
+  // Sweep over a regular grid of hexahedra with one randomly placed sphere per
+  // element, comparing the full and the compact element representation.
+  TEST_CASE("CompactHexahedronGrid") {
+    constexpr auto seed = 79'866'982'766'580U;
+    constexpr auto cells = 16U;
+    constexpr auto iterations = 10U;
+
+    auto rng = ankerl::nanobench::Rng{seed};
+
+    auto hexes = std::vector<Hexahedron>{};
+    auto spheres = std::vector<Sphere>{};
+    for (auto i = 0U; i < cells; ++i) {
+      for (auto j = 0U; j < cells; ++j) {
+        for (auto k = 0U; k < cells; ++k) {
+          const auto origin =
+              Vector{static_cast<Scalar>(i), static_cast<Scalar>(j),
+                     static_cast<Scalar>(k)};
+
+          hexes.emplace_back(
+              origin + Vector{0, 0, 0}, origin + Vector{1, 0, 0},
+              origin + Vector{1, 1, 0}, origin + Vector{0, 1, 0},
+              origin + Vector{0, 0, 1}, origin + Vector{1, 0, 1},
+              origin + Vector{1, 1, 1}, origin + Vector{0, 1, 1});
+
+          const auto center = Vector{
+              origin +
+              Vector{rng.uniform01(), rng.uniform01(), rng.uniform01()}};
+          spheres.emplace_back(center, 0.1 + 0.4 * rng.uniform01());
+        }
+      }
+    }
+
+    const auto compact_hexes =
+        std::vector<CompactHexahedron>(hexes.begin(), hexes.end());
+
+    MESSAGE("element size: Hexahedron ", sizeof(Hexahedron),
+            " bytes, CompactHexahedron ", sizeof(CompactHexahedron),
+            " bytes");
+
+    MESSAGE("mesh size: Hexahedron ", hexes.size() * sizeof(Hexahedron),
+            " bytes, CompactHexahedron ",
+            compact_hexes.size() * sizeof(CompactHexahedron), " bytes");
+
+    create_benchmark(
+        "compact_elements[Hexahedron]",
+        [&]() {
+          auto sum = Scalar{0};
+          for (auto idx = 0U; idx < hexes.size(); ++idx) {
+            sum += overlap_volume(spheres[idx], hexes[idx]);
+          }
+
+          ankerl::nanobench::doNotOptimizeAway(sum);
+        },
+        iterations);
+
+    create_benchmark(
+        "compact_elements[CompactHexahedron]",
+        [&]() {
+          auto sum = Scalar{0};
+          for (auto idx = 0U; idx < compact_hexes.size(); ++idx) {
+            sum += overlap_volume(spheres[idx], compact_hexes[idx]);
+          }
+
+          ankerl::nanobench::doNotOptimizeAway(sum);
+        },
+        iterations);
+  }
+}
@@ -0,0 +1,90 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include <doctest/doctest.h>
+
+#include "overlap/overlap.hpp"
+
+#include "common.hpp"
+
+TEST_SUITE("ContactTime") {
+  using namespace overlap;
+
+  // clang-format off
+  const auto hex = Hexahedron{{{
+      {-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1},
+      {-1, -1,  1}, {1, -1,  1}, {1, 1,  1}, {-1, 1,  1},
+  }}};
+  // clang-format on
+
+  TEST_CASE("ContactTimeRandomized") {
+    constexpr auto seed = 79'866'982'766'580U;
+    auto rng = ankerl::nanobench::Rng{seed};
+
+    // spheres starting outside of the element, moving towards a point close
+    // to its center within unit time
+    const auto random_trajectory = [&rng]() {
+      const auto direction =
+          Vector{Vector{rng.uniform01(), rng.uniform01(), rng.uniform01()} -
+                 Vector::Constant(0.5)}
+              .normalized();
+      const auto sphere =
+          Sphere{Vector{4.0 * direction}, (0.5 * rng.uniform01()) + 0.3};
+      const auto target = Vector{
+          Vector{rng.uniform01(), rng.uniform01(), rng.uniform01()} -
+          Vector::Constant(0.5)};
+
+      return std::make_pair(sphere, Vector{target - sphere.center});
+    };
+
+    create_benchmark("contact_time[analytic]", [&]() {
+      const auto [sphere, velocity] = random_trajectory();
+      const auto result = contact_time(sphere, velocity, hex);
+      ankerl::nanobench::doNotOptimizeAway(result);
+    }).epochIterations(25'000);
+
+    rng = ankerl::nanobench::Rng{seed};
+    create_benchmark("contact_time[bisection]", [&]() {
+      const auto [sphere, velocity] = random_trajectory();
+
+      auto lower = 0.0;
+      auto upper = 1.0;
+      for (auto iteration = 0; iteration < 40; ++iteration) {
+        const auto mid = 0.5 * (lower + upper);
+        const auto volume = overlap_volume(
+            Sphere{sphere.center + mid * velocity, sphere.radius}, hex);
+        (volume > 0.0 ? upper : lower) = mid;
+      }
+
+      ankerl::nanobench::doNotOptimizeAway(upper);
+    }).epochIterations(1'000);
+
+    rng = ankerl::nanobench::Rng{seed};
+    create_benchmark("overlap_volume_time[newton]", [&]() {
+      const auto [sphere, velocity] = random_trajectory();
+      const auto result =
+          overlap_volume_time(sphere, velocity, hex, 0.5 * sphere.volume);
+      ankerl::nanobench::doNotOptimizeAway(result);
+    }).epochIterations(2'500);
+
+    rng = ankerl::nanobench::Rng{seed};
+    create_benchmark("overlap_volume_time[bisection]", [&]() {
+      const auto [sphere, velocity] = random_trajectory();
+
+      auto lower = 0.0;
+      auto upper = 1.0;
+      for (auto iteration = 0; iteration < 40; ++iteration) {
+        const auto mid = 0.5 * (lower + upper);
+        const auto volume = overlap_volume(
+            Sphere{sphere.center + mid * velocity, sphere.radius}, hex);
+        (volume >= 0.5 * sphere.volume ? upper : lower) = mid;
+      }
+
+      ankerl::nanobench::doNotOptimizeAway(upper);
+    }).epochIterations(1'000);
+  }
+}
@@ -0,0 +1,116 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "overlap/overlap.hpp"
+
+#include "common.hpp"
+
+TEST_SUITE("ConvexPolyhedron") {
+  using namespace overlap;
+
+  using FaceList = std::vector<std::vector<std::uint32_t>>;
+
+  const auto random_sphere = [](ankerl::nanobench::Rng& rng) {
+    const auto radius = (2.4 * rng.uniform01()) + 0.1;
+    const auto center = Vector{
+        4.0 * Vector{rng.uniform01(), rng.uniform01(), rng.uniform01()} -
+        Vector::Constant(2.0)};
+
+    return Sphere{center, radius};
+  };
+
+  TEST_CASE("CubeOverlapVolumeRandomized") {
+    // clang-format off
+    const auto vertices = std::vector<Vector>{
+        {-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1},
+        {-1, -1,  1}, {1, -1,  1}, {1, 1,  1}, {-1, 1,  1},
+    };
+    // clang-format on
+
+    const auto cube = ConvexPolyhedron{
+        vertices, FaceList{{0, 3, 2, 1},
+                           {0, 1, 5, 4},
+                           {1, 2, 6, 5},
+                           {2, 3, 7, 6},
+                           {0, 4, 7, 3},
+                           {4, 5, 6, 7}}};
+
+    const auto hex = Hexahedron{vertices[0], vertices[1], vertices[2],
+                                vertices[3], vertices[4], vertices[5],
+                                vertices[6], vertices[7]};
+
+    constexpr auto seed = 79'866'982'766'580U;
+    auto rng = ankerl::nanobench::Rng{seed};
+
+    create_benchmark("convex_polyhedron_overlap_volume[random-cube]", [&]() {
+      const auto result = overlap_volume(random_sphere(rng), cube);
+      ankerl::nanobench::doNotOptimizeAway(result);
+    }).epochIterations(25'000);
+
+    rng = ankerl::nanobench::Rng{seed};
+    create_benchmark("convex_polyhedron_overlap_volume[random-hexahedron]",
+                     [&]() {
+                       const auto result = overlap_volume(random_sphere(rng),
+                                                          hex);
+                       ankerl::nanobench::doNotOptimizeAway(result);
+                     })
+        .epochIterations(25'000);
+  }
+
+  TEST_CASE("HexagonalPrismOverlapVolumeRandomized") {
+    // prism with a regular hexagon as base, 8 faces and 12 vertices
+    auto vertices = std::vector<Vector>{};
+    for (const auto z : {-1.0, 1.0}) {
+      for (auto idx = 0; idx < 6; ++idx) {
+        const auto phi = idx * (detail::pi / 3.0);
+        vertices.emplace_back(1.5 * std::cos(phi), 1.5 * std::sin(phi), z);
+      }
+    }
+
+    auto faces = FaceList{{5, 4, 3, 2, 1, 0}, {6, 7, 8, 9, 10, 11}};
+    for (auto idx = 0u; idx < 6u; ++idx) {
+      const auto next = (idx + 1) % 6;
+      faces.push_back({idx, next, next + 6, idx + 6});
+    }
+
+    const auto prism = ConvexPolyhedron{vertices, faces};
+
+    auto tets = std::vector<Tetrahedron>{};
+    detail::decompose(prism, tets);
+
+    constexpr auto seed = 79'866'982'766'580U;
+    auto rng = ankerl::nanobench::Rng{seed};
+
+    create_benchmark("convex_polyhedron_overlap_volume[random-hexagonal-prism]",
+                     [&]() {
+                       const auto result = overlap_volume(random_sphere(rng),
+                                                          prism);
+                       ankerl::nanobench::doNotOptimizeAway(result);
+                     })
+        .epochIterations(25'000);
+
+    rng = ankerl::nanobench::Rng{seed};
+    create_benchmark(
+        "convex_polyhedron_overlap_volume[random-hexagonal-prism-decomposed]",
+        [&]() {
+          const auto sphere = random_sphere(rng);
+          auto result = Scalar{0};
+          for (const auto& tet : tets) {
+            result += overlap_volume(sphere, tet);
+          }
+
+          ankerl::nanobench::doNotOptimizeAway(result);
+        })
+        .epochIterations(25'000);
+  }
+}
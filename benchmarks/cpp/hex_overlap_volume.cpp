@@ -63,4 +63,40 @@ TEST_SUITE("HexOverlap") {
       ankerl::nanobench::doNotOptimizeAway(result);
     }).epochIterations(25'000);
   }
+
+  TEST_CASE("HexOverlapVolumeEstimateRandomized") {
+    constexpr auto seed = 79'866'982'766'580U;
+    auto rng = ankerl::nanobench::Rng{seed};
+
+    create_benchmark("hex_overlap_volume[estimate-random]", [&rng]() {
+      const auto radius = (2.4 * rng.uniform01()) + 0.1;
+      const auto center = Vector{
+          4.0 * Vector{rng.uniform01(), rng.uniform01(), rng.uniform01()} -
+          Vector::Constant(2.0)};
+
+      const auto sphere = overlap::Sphere{center, radius};
+      const auto result = overlap_volume_estimate(sphere, hex);
+      ankerl::nanobench::doNotOptimizeAway(result);
+    }).epochIterations(25'000);
+  }
+
+  TEST_CASE("HexOverlapVolumeAdaptiveRandomized") {
+    constexpr auto seed = 79'866'982'766'580U;
+    auto rng = ankerl::nanobench::Rng{seed};
+    auto statistics = overlap::FallbackStatistics{};
+
+    create_benchmark("hex_overlap_volume[adaptive-random]", [&]() {
+      const auto radius = (2.4 * rng.uniform01()) + 0.1;
+      const auto center = Vector{
+          4.0 * Vector{rng.uniform01(), rng.uniform01(), rng.uniform01()} -
+          Vector::Constant(2.0)};
+
+      const auto sphere = overlap::Sphere{center, radius};
+      const auto result = overlap_volume_adaptive(
+          sphere, hex, 1e-12 * sphere.volume, &statistics);
+      ankerl::nanobench::doNotOptimizeAway(result);
+    }).epochIterations(25'000);
+
+    MESSAGE("fallback rate: ", statistics.fallback_rate());
+  }
 }
@@ -0,0 +1,109 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include <algorithm>
+#include <array>
+#include <variant>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "overlap/overlap.hpp"
+
+#include "common.hpp"
+
+TEST_SUITE("HybridMesh") {
+  using namespace overlap;
+
+  using Cell = std::variant<Tetrahedron, Wedge, Hexahedron>;
+
+  // Block of 16^3 unit cells, meshed with hexahedra in the lower, wedges in the
+  // middle and tetrahedra in the upper third, mimicking a boundary layer mesh.
+  // The cells are numbered randomly as typical for unstructured meshes.
+  const auto create_cells = [](ankerl::nanobench::Rng& rng) {
+    constexpr auto cells_per_dim = 16;
+
+    auto cells = std::vector<Cell>{};
+    for (auto k = 0; k < cells_per_dim; ++k) {
+      for (auto j = 0; j < cells_per_dim; ++j) {
+        for (auto i = 0; i < cells_per_dim; ++i) {
+          const auto o = Vector{Scalar(i), Scalar(j), Scalar(k)};
+          const auto hex =
+              Hexahedron{o + Vector{0, 0, 0}, o + Vector{1, 0, 0},
+                         o + Vector{1, 1, 0}, o + Vector{0, 1, 0},
+                         o + Vector{0, 0, 1}, o + Vector{1, 0, 1},
+                         o + Vector{1, 1, 1}, o + Vector{0, 1, 1}};
+
+          if (3 * k < cells_per_dim) {
+            cells.emplace_back(hex);
+          } else if (3 * k < 2 * cells_per_dim) {
+            auto wedges = std::array<Wedge, 2>{};
+            detail::decompose(hex, wedges);
+            cells.insert(cells.end(), wedges.begin(), wedges.end());
+          } else {
+            auto tets = std::array<Tetrahedron, 5>{};
+            detail::decompose(hex, tets);
+            cells.insert(cells.end(), tets.begin(), tets.end());
+          }
+        }
+      }
+    }
+
+    rng.shuffle(cells);
+
+    return cells;
+  };
+
+  TEST_CASE("HybridMeshOverlapVolumes") {
+    constexpr auto seed = 79'866'982'766'580U;
+    auto rng = ankerl::nanobench::Rng{seed};
+
+    const auto cells = create_cells(rng);
+
+    auto mesh = HybridMesh<Tetrahedron, Wedge, Hexahedron>{};
+    for (const auto& cell : cells) {
+      std::visit([&](const auto& element) { mesh.push_back(element); }, cell);
+    }
+
+    auto spheres = std::vector<Sphere>{};
+    for (auto idx = 0; idx < 16; ++idx) {
+      const auto center = Vector{
+          16.0 * Vector{rng.uniform01(), rng.uniform01(), rng.uniform01()}};
+      spheres.emplace_back(center, 0.5 + 1.5 * rng.uniform01());
+    }
+
+    auto results = std::vector<Scalar>(cells.size());
+
+    create_benchmark(
+        "hybrid_mesh_overlap_volumes[variant]",
+        [&]() {
+          for (const auto& sphere : spheres) {
+            std::transform(cells.begin(), cells.end(), results.begin(),
+                           [&](const Cell& cell) {
+                             return std::visit(
+                                 [&](const auto& element) {
+                                   return overlap_volume(sphere, element);
+                                 },
+                                 cell);
+                           });
+
+            ankerl::nanobench::doNotOptimizeAway(results);
+          }
+        },
+        10);
+
+    create_benchmark(
+        "hybrid_mesh_overlap_volumes[batched]",
+        [&]() {
+          for (const auto& sphere : spheres) {
+            results = overlap_volumes(sphere, mesh);
+            ankerl::nanobench::doNotOptimizeAway(results);
+          }
+        },
+        10);
+  }
+}
@@ -0,0 +1,110 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include <cmath>
+
+#include <doctest/doctest.h>
+
+#include "overlap/overlap.hpp"
+
+#include "common.hpp"
+
+TEST_SUITE("LatticeCache") {
+  using namespace overlap;
+
+  // clang-format off
+  const auto cell = Hexahedron{{{
+      {0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0},
+      {0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1},
+  }}};
+  // clang-format on
+
+  constexpr auto radius = 0.4;
+
+  // Sum of the overlap volumes of a sphere and the 27 cells of the lattice
+  // around the cell holding its center.
+  template<typename F>
+  auto voxelize(const Vector& center, F&& volume) -> Scalar {
+    const auto origin = Vector{center.array().floor()};
+
+    auto result = Scalar{0};
+    for (auto k = -1; k <= 1; ++k) {
+      for (auto j = -1; j <= 1; ++j) {
+        for (auto i = -1; i <= 1; ++i) {
+          result += volume(Vector{origin + Vector{Scalar(i), Scalar(j),
+                                                  Scalar(k)}});
+        }
+      }
+    }
+
+    return result;
+  }
+
+  TEST_CASE("LatticeCacheRandomized") {
+    constexpr auto seed = 79'866'982'766'580U;
+    auto rng = ankerl::nanobench::Rng{seed};
+
+    // particles located on a lattice commensurate with the cells
+    const auto random_center = [&rng]() {
+      return Vector{Scalar(rng.bounded(64)) / 8.0,
+                    Scalar(rng.bounded(64)) / 8.0,
+                    Scalar(rng.bounded(64)) / 8.0};
+    };
+
+    create_benchmark(
+        "lattice_cache[exact]",
+        [&]() {
+          const auto center = random_center();
+          const auto result = voxelize(center, [&](const Vector& translation) {
+            auto vertices = cell.vertices;
+            for (auto& vertex : vertices) {
+              vertex += translation;
+            }
+
+            return overlap_volume(Sphere{center, radius},
+                                  Hexahedron{vertices});
+          });
+
+          ankerl::nanobench::doNotOptimizeAway(result);
+        },
+        1'000);
+
+    rng = ankerl::nanobench::Rng{seed};
+    auto cache = LatticeCache<Hexahedron>{cell, 1e-6};
+    create_benchmark(
+        "lattice_cache[cache]",
+        [&]() {
+          const auto center = random_center();
+          const auto result = voxelize(center, [&](const Vector& translation) {
+            return cache.volume(Sphere{center, radius}, translation);
+          });
+
+          ankerl::nanobench::doNotOptimizeAway(result);
+        },
+        1'000);
+
+    MESSAGE("cache entries: ", cache.size(), ", hit rate: ",
+            static_cast<double>(cache.hits()) /
+                static_cast<double>(cache.hits() + cache.misses()));
+
+    rng = ankerl::nanobench::Rng{seed};
+    const auto table = OverlapVolumeTable<Hexahedron>{cell, radius, 65};
+    create_benchmark(
+        "lattice_cache[table]",
+        [&]() {
+          const auto center = random_center();
+          const auto result = voxelize(center, [&](const Vector& translation) {
+            return table.volume(center, translation);
+          });
+
+          ankerl::nanobench::doNotOptimizeAway(result);
+        },
+        1'000);
+
+    MESSAGE("table error bound: ", table.error_bound());
+  }
+}
@@ -0,0 +1,95 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "overlap/overlap.hpp"
+
+#include "common.hpp"
+
+TEST_SUITE("Monodisperse") {
+  using namespace overlap;
+
+  // clang-format off
+  const auto hex = Hexahedron{{{
+      {-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1},
+      {-1, -1,  1}, {1, -1,  1}, {1, 1,  1}, {-1, 1,  1},
+  }}};
+  // clang-format on
+
+  TEST_CASE("MonodisperseOverlapVolume") {
+    constexpr auto seed = 79'866'982'766'580U;
+    constexpr auto radius = 0.8;
+
+    auto rng = ankerl::nanobench::Rng{seed};
+    const auto random_sphere = [&rng]() {
+      const auto center = Vector{
+          4.0 * Vector{rng.uniform01(), rng.uniform01(), rng.uniform01()} -
+          Vector::Constant(2.0)};
+
+      return Sphere{center, radius};
+    };
+
+    create_benchmark("monodisperse_overlap_volume[hex]", [&]() {
+      const auto result = overlap_volume(random_sphere(), hex);
+      ankerl::nanobench::doNotOptimizeAway(result);
+    }).epochIterations(25'000);
+
+    const auto prescaled = PrescaledElement<Hexahedron>{hex, radius};
+
+    rng = ankerl::nanobench::Rng{seed};
+    create_benchmark("monodisperse_overlap_volume[hex-prescaled]", [&]() {
+      const auto result = overlap_volume(random_sphere(), prescaled);
+      ankerl::nanobench::doNotOptimizeAway(result);
+    }).epochIterations(25'000);
+  }
+
+  TEST_CASE("BidisperseOverlapVolumePairs") {
+    constexpr auto seed = 79'866'982'766'580U;
+    constexpr auto batch_size = 1'000U;
+    constexpr auto iterations = 100U;
+
+    auto rng = ankerl::nanobench::Rng{seed};
+
+    // two sphere sizes, in random order
+    auto spheres = std::vector<Sphere>{};
+    auto pairs = std::vector<SphereElementPair>{};
+    for (auto idx = 0U; idx < batch_size; ++idx) {
+      const auto center = Vector{
+          4.0 * Vector{rng.uniform01(), rng.uniform01(), rng.uniform01()} -
+          Vector::Constant(2.0)};
+
+      spheres.emplace_back(center, rng.uniform01() < 0.5 ? 0.5 : 1.0);
+      pairs.emplace_back(idx, 0U);
+    }
+
+    const auto elements = std::vector<Hexahedron>{hex};
+
+    create_benchmark(
+        "monodisperse_overlap_volume_pairs[per-pair]",
+        [&]() {
+          auto sum = Scalar{0};
+          for (const auto& [sphere_idx, element_idx] : pairs) {
+            sum += overlap_volume(spheres[sphere_idx], elements[element_idx]);
+          }
+
+          ankerl::nanobench::doNotOptimizeAway(sum);
+        },
+        iterations);
+
+    create_benchmark(
+        "monodisperse_overlap_volume_pairs[bucketed]",
+        [&]() {
+          const auto results =
+              overlap_volume_pairs_bucketed(spheres, elements, pairs);
+          ankerl::nanobench::doNotOptimizeAway(results);
+        },
+        iterations);
+  }
+}
@@ -0,0 +1,83 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "overlap/overlap.hpp"
+
+#include "common.hpp"
+
+TEST_SUITE("Octree") {
+  using namespace overlap;
+
+  TEST_CASE("OctreeRandomized") {
+    // octree covering [0, 4]^3, refined uniformly to level 3 and up to level 5
+    // in the octant at the origin
+    auto octree = Octree{Vector::Zero(), Vector::Constant(4)};
+    for (auto level = 0u; level < 5u; ++level) {
+      const auto size = octree.size();
+      for (auto node_idx = 0u; node_idx < size; ++node_idx) {
+        const auto& box = octree.node(node_idx).box;
+        if (octree.is_leaf(node_idx) &&
+            (level < 3u || box.max().maxCoeff() <= 2.0)) {
+          octree.refine(node_idx);
+        }
+      }
+    }
+
+    auto leaves = std::vector<Hexahedron>{};
+    for (auto node_idx = 0u; node_idx < octree.size(); ++node_idx) {
+      if (octree.is_leaf(node_idx)) {
+        leaves.push_back(octree.cell(node_idx));
+      }
+    }
+
+    MESSAGE("octree cells: ", octree.size(), ", leaves: ", leaves.size());
+
+    constexpr auto seed = 79'866'982'766'580U;
+    auto rng = ankerl::nanobench::Rng{seed};
+
+    const auto random_sphere = [&rng]() {
+      const auto radius = (1.4 * rng.uniform01()) + 0.1;
+      const auto center = Vector{
+          4.0 * Vector{rng.uniform01(), rng.uniform01(), rng.uniform01()}};
+
+      return Sphere{center, radius};
+    };
+
+    create_benchmark(
+        "octree[leaves]",
+        [&]() {
+          const auto sphere = random_sphere();
+
+          auto result = Scalar{0};
+          for (const auto& leaf : leaves) {
+            result += overlap_volume(sphere, leaf);
+          }
+
+          ankerl::nanobench::doNotOptimizeAway(result);
+        },
+        100);
+
+    rng = ankerl::nanobench::Rng{seed};
+    auto statistics = OctreeStatistics{};
+    create_benchmark(
+        "octree[hierarchical]",
+        [&]() {
+          const auto result =
+              overlap_volumes(random_sphere(), octree, &statistics);
+          ankerl::nanobench::doNotOptimizeAway(result);
+        },
+        100);
+
+    const auto queries = static_cast<double>(statistics.queries);
+    MESSAGE("visited nodes per sphere: ", statistics.visited_nodes / queries);
+    MESSAGE("exact leaves per sphere: ", statistics.exact_leaves / queries);
+  }
+}
@@ -0,0 +1,77 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include <array>
+
+#include <doctest/doctest.h>
+
+#include "overlap/overlap.hpp"
+
+#include "common.hpp"
+
+TEST_SUITE("OverlapMoments") {
+  using namespace overlap;
+
+  // clang-format off
+  const auto hex = Hexahedron{{{
+      {-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1},
+      {-1, -1,  1}, {1, -1,  1}, {1, 1,  1}, {-1, 1,  1},
+  }}};
+  // clang-format on
+
+  TEST_CASE("OverlapMomentsRandomized") {
+    constexpr auto seed = 79'866'982'766'580U;
+    auto rng = ankerl::nanobench::Rng{seed};
+
+    const auto random_sphere = [&rng]() {
+      const auto radius = (2.4 * rng.uniform01()) + 0.1;
+      const auto center = Vector{
+          4.0 * Vector{rng.uniform01(), rng.uniform01(), rng.uniform01()} -
+          Vector::Constant(2.0)};
+
+      return Sphere{center, radius};
+    };
+
+    create_benchmark("overlap_moments[volume]", [&]() {
+      const auto result = overlap_volume(random_sphere(), hex);
+      ankerl::nanobench::doNotOptimizeAway(result);
+    }).epochIterations(25'000);
+
+    rng = ankerl::nanobench::Rng{seed};
+    create_benchmark("overlap_moments[analytic]", [&]() {
+      const auto result = overlap_moments(random_sphere(), hex);
+      ankerl::nanobench::doNotOptimizeAway(result);
+    }).epochIterations(25'000);
+
+    // approximation of the centroid by a single level of subdivision into
+    // octants, weighting the center of each octant by its overlap volume
+    auto octants = std::array<Hexahedron, 8>{};
+    for (auto idx = 0u; idx < octants.size(); ++idx) {
+      const auto offset = Vector{Scalar(idx & 1u), Scalar((idx >> 1u) & 1u),
+                                 Scalar((idx >> 2u) & 1u)};
+      const auto o = Vector{offset - Vector::Ones()};
+
+      octants[idx] = Hexahedron{
+          o + Vector{0, 0, 0}, o + Vector{1, 0, 0}, o + Vector{1, 1, 0},
+          o + Vector{0, 1, 0}, o + Vector{0, 0, 1}, o + Vector{1, 0, 1},
+          o + Vector{1, 1, 1}, o + Vector{0, 1, 1}};
+    }
+
+    rng = ankerl::nanobench::Rng{seed};
+    create_benchmark("overlap_moments[subdivided]", [&]() {
+      const auto sphere = random_sphere();
+      auto result = OverlapMoments{};
+      for (const auto& octant : octants) {
+        const auto volume = overlap_volume(sphere, octant);
+        result.volume += volume;
+        result.first_moment += volume * octant.center;
+      }
+
+      ankerl::nanobench::doNotOptimizeAway(result);
+    }).epochIterations(2'500);
+  }
+}
@@ -0,0 +1,78 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "overlap/overlap.hpp"
+
+#include "common.hpp"
+
+TEST_SUITE("OverlapOwner") {
+  using namespace overlap;
+
+  TEST_CASE("OverlapOwnerRandomized") {
+    // candidate cells: 3 x 3 x 3 block of unit cubes covering [0, 3]^3
+    auto cells = std::vector<Hexahedron>{};
+    for (auto k = 0; k < 3; ++k) {
+      for (auto j = 0; j < 3; ++j) {
+        for (auto i = 0; i < 3; ++i) {
+          const auto o = Vector{Scalar(i), Scalar(j), Scalar(k)};
+          cells.emplace_back(
+              Vector{o + Vector{0, 0, 0}}, Vector{o + Vector{1, 0, 0}},
+              Vector{o + Vector{1, 1, 0}}, Vector{o + Vector{0, 1, 0}},
+              Vector{o + Vector{0, 0, 1}}, Vector{o + Vector{1, 0, 1}},
+              Vector{o + Vector{1, 1, 1}}, Vector{o + Vector{0, 1, 1}});
+        }
+      }
+    }
+
+    constexpr auto seed = 79'866'982'766'580U;
+    auto rng = ankerl::nanobench::Rng{seed};
+
+    // particles located in the central cell
+    const auto random_sphere = [&rng]() {
+      const auto radius = (0.9 * rng.uniform01()) + 0.1;
+      const auto center = Vector{
+          Vector{rng.uniform01(), rng.uniform01(), rng.uniform01()} +
+          Vector::Constant(1.0)};
+
+      return Sphere{center, radius};
+    };
+
+    create_benchmark(
+        "overlap_owner[exact]",
+        [&]() {
+          const auto sphere = random_sphere();
+
+          auto result = std::make_pair(cells.cend(), Scalar{0});
+          for (auto it = cells.cbegin(); it != cells.cend(); ++it) {
+            const auto volume = overlap_volume(sphere, *it);
+            if (volume > result.second) {
+              result = std::make_pair(it, volume);
+            }
+          }
+
+          ankerl::nanobench::doNotOptimizeAway(result);
+        },
+        1'000);
+
+    rng = ankerl::nanobench::Rng{seed};
+    auto statistics = BoundsStatistics{};
+    create_benchmark(
+        "overlap_owner[pruned]",
+        [&]() {
+          const auto result = overlap_owner(random_sphere(), cells.cbegin(),
+                                            cells.cend(), &statistics);
+          ankerl::nanobench::doNotOptimizeAway(result);
+        },
+        1'000);
+
+    MESSAGE("exact evaluations per candidate: ", statistics.exact_rate());
+  }
+}
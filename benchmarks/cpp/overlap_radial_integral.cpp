@@ -0,0 +1,84 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include <array>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "overlap/overlap.hpp"
+
+#include "common.hpp"
+
+TEST_SUITE("OverlapRadialIntegral") {
+  using namespace overlap;
+
+  // clang-format off
+  const auto hex = Hexahedron{{{
+      {-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1},
+      {-1, -1,  1}, {1, -1,  1}, {1, 1,  1}, {-1, 1,  1},
+  }}};
+  // clang-format on
+
+  // Lucy kernel (1 + 3 q) (1 - q)^3 without normalization
+  const auto lucy = std::array<Scalar, 5>{1, 0, -6, 8, -3};
+
+  TEST_CASE("OverlapRadialIntegralRandomized") {
+    constexpr auto seed = 79'866'982'766'580U;
+    auto rng = ankerl::nanobench::Rng{seed};
+
+    const auto random_sphere = [&rng]() {
+      const auto radius = (2.4 * rng.uniform01()) + 0.1;
+      const auto center = Vector{
+          4.0 * Vector{rng.uniform01(), rng.uniform01(), rng.uniform01()} -
+          Vector::Constant(2.0)};
+
+      return Sphere{center, radius};
+    };
+
+    create_benchmark("overlap_radial_integral[volume]", [&]() {
+      const auto result = overlap_volume(random_sphere(), hex);
+      ankerl::nanobench::doNotOptimizeAway(result);
+    }).epochIterations(25'000);
+
+    rng = ankerl::nanobench::Rng{seed};
+    create_benchmark("overlap_radial_integral[lucy]", [&]() {
+      const auto result = overlap_radial_integral(random_sphere(), hex, lucy);
+      ankerl::nanobench::doNotOptimizeAway(result);
+    }).epochIterations(25'000);
+
+    // Monte Carlo estimate based on 1000 fixed points in the unit sphere
+    auto points = std::vector<Vector>{};
+    auto point_rng = ankerl::nanobench::Rng{seed};
+    while (points.size() < 1000u) {
+      const auto p = Vector{2.0 * Vector{point_rng.uniform01(),
+                                         point_rng.uniform01(),
+                                         point_rng.uniform01()} -
+                            Vector::Ones()};
+      if (p.squaredNorm() <= 1.0) {
+        points.push_back(p);
+      }
+    }
+
+    rng = ankerl::nanobench::Rng{seed};
+    create_benchmark("overlap_radial_integral[sampled]", [&]() {
+      const auto sphere = random_sphere();
+
+      auto result = Scalar{0};
+      for (const auto& p : points) {
+        const auto x = Vector{sphere.center + sphere.radius * p};
+        if (x.cwiseAbs().maxCoeff() <= 1.0) {
+          const auto q = p.norm();
+          result += (1.0 + 3.0 * q) * (1.0 - q) * (1.0 - q) * (1.0 - q);
+        }
+      }
+
+      result *= sphere.volume / Scalar(points.size());
+      ankerl::nanobench::doNotOptimizeAway(result);
+    }).epochIterations(2'500);
+  }
+}
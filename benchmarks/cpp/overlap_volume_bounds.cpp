@@ -0,0 +1,67 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include <string>
+
+#include <doctest/doctest.h>
+
+#include "overlap/overlap.hpp"
+
+#include "common.hpp"
+
+TEST_SUITE("OverlapVolumeBounds") {
+  using namespace overlap;
+
+  // clang-format off
+  const auto hex = Hexahedron{{{
+      {-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1},
+      {-1, -1,  1}, {1, -1,  1}, {1, 1,  1}, {-1, 1,  1},
+  }}};
+  // clang-format on
+
+  TEST_CASE("OverlapExceedsRandomized") {
+    constexpr auto seed = 79'866'982'766'580U;
+    auto rng = ankerl::nanobench::Rng{seed};
+
+    const auto random_sphere = [&rng]() {
+      const auto radius = (2.4 * rng.uniform01()) + 0.1;
+      const auto center = Vector{
+          4.0 * Vector{rng.uniform01(), rng.uniform01(), rng.uniform01()} -
+          Vector::Constant(2.0)};
+
+      return Sphere{center, radius};
+    };
+
+    create_benchmark("overlap_volume_bounds[bounds]", [&]() {
+      const auto result = overlap_volume_bounds(random_sphere(), hex);
+      ankerl::nanobench::doNotOptimizeAway(result);
+    });
+
+    // mark elements cut by more than 1% and 50% of their volume
+    for (const auto fraction : {0.01, 0.5}) {
+      const auto threshold = fraction * hex.volume;
+      const auto suffix = std::to_string(static_cast<int>(100 * fraction));
+
+      rng = ankerl::nanobench::Rng{seed};
+      create_benchmark("overlap_exceeds[exact-" + suffix + "%]", [&]() {
+        const auto result = overlap_volume(random_sphere(), hex) > threshold;
+        ankerl::nanobench::doNotOptimizeAway(result);
+      });
+
+      rng = ankerl::nanobench::Rng{seed};
+      auto statistics = BoundsStatistics{};
+      create_benchmark("overlap_exceeds[bounds-" + suffix + "%]", [&]() {
+        const auto result =
+            overlap_exceeds(random_sphere(), hex, threshold, &statistics);
+        ankerl::nanobench::doNotOptimizeAway(result);
+      });
+
+      MESSAGE("exact evaluations (", suffix,
+              "%): ", statistics.exact_rate());
+    }
+  }
+}
@@ -0,0 +1,85 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include <doctest/doctest.h>
+
+#include "overlap/overlap.hpp"
+
+#include "common.hpp"
+
+TEST_SUITE("OverlapVolumeGradient") {
+  using namespace overlap;
+
+  // clang-format off
+  const auto hex = Hexahedron{{{
+      {-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1},
+      {-1, -1,  1}, {1, -1,  1}, {1, 1,  1}, {-1, 1,  1},
+  }}};
+  // clang-format on
+
+  TEST_CASE("OverlapVolumeGradientRandomized") {
+    constexpr auto seed = 79'866'982'766'580U;
+    auto rng = ankerl::nanobench::Rng{seed};
+
+    const auto random_sphere = [&rng]() {
+      const auto radius = (2.4 * rng.uniform01()) + 0.1;
+      const auto center = Vector{
+          4.0 * Vector{rng.uniform01(), rng.uniform01(), rng.uniform01()} -
+          Vector::Constant(2.0)};
+
+      return Sphere{center, radius};
+    };
+
+    create_benchmark("overlap_volume_gradient[volume]", [&]() {
+      const auto result = overlap_volume(random_sphere(), hex);
+      ankerl::nanobench::doNotOptimizeAway(result);
+    }).epochIterations(25'000);
+
+    rng = ankerl::nanobench::Rng{seed};
+    create_benchmark("overlap_volume_gradient[analytic]", [&]() {
+      const auto result = overlap_volume_gradient(random_sphere(), hex);
+      ankerl::nanobench::doNotOptimizeAway(result);
+    }).epochIterations(25'000);
+
+    // volume and central differences w.r.t. the center and the radius
+    rng = ankerl::nanobench::Rng{seed};
+    create_benchmark("overlap_volume_gradient[finite-differences]", [&]() {
+      constexpr auto h = 1e-6;
+
+      const auto sphere = random_sphere();
+      auto result = overlap_volume(sphere, hex);
+      for (auto dim = 0; dim < 3; ++dim) {
+        const auto offset = Vector{h * Vector::Unit(dim)};
+        result += overlap_volume(
+                      Sphere{sphere.center + offset, sphere.radius}, hex) -
+                  overlap_volume(
+                      Sphere{sphere.center - offset, sphere.radius}, hex);
+      }
+
+      result += overlap_volume(Sphere{sphere.center, sphere.radius + h}, hex) -
+                overlap_volume(Sphere{sphere.center, sphere.radius - h}, hex);
+
+      ankerl::nanobench::doNotOptimizeAway(result);
+    }).epochIterations(2'500);
+  }
+
+  TEST_CASE("OverlapVolumeVertexGradientRandomized") {
+    constexpr auto seed = 79'866'982'766'580U;
+    auto rng = ankerl::nanobench::Rng{seed};
+
+    create_benchmark("overlap_volume_vertex_gradient[analytic]", [&]() {
+      const auto radius = (2.4 * rng.uniform01()) + 0.1;
+      const auto center = Vector{
+          4.0 * Vector{rng.uniform01(), rng.uniform01(), rng.uniform01()} -
+          Vector::Constant(2.0)};
+
+      const auto result =
+          overlap_volume_vertex_gradient(Sphere{center, radius}, hex);
+      ankerl::nanobench::doNotOptimizeAway(result);
+    }).epochIterations(25'000);
+  }
+}
@@ -0,0 +1,86 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "overlap/overlap.hpp"
+
+#include "common.hpp"
+
+TEST_SUITE("PairPipeline") {
+  using namespace overlap;
+
+  // clang-format off
+  const auto hex = Hexahedron{{{
+      {-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1},
+      {-1, -1,  1}, {1, -1,  1}, {1, 1,  1}, {-1, 1,  1},
+  }}};
+  // clang-format on
+
+  TEST_CASE("PairPipelineMixedBatch") {
+    constexpr auto seed = 79'866'982'766'580U;
+    constexpr auto batch_size = 1'000U;
+    constexpr auto iterations = 100U;
+
+    auto rng = ankerl::nanobench::Rng{seed};
+
+    // a mixed batch of disjoint, contained and intersecting configurations
+    auto spheres = std::vector<Sphere>{};
+    auto pairs = std::vector<SphereElementPair>{};
+    for (auto idx = 0U; idx < batch_size; ++idx) {
+      const auto radius = (2.4 * rng.uniform01()) + 0.1;
+      const auto center = Vector{
+          8.0 * Vector{rng.uniform01(), rng.uniform01(), rng.uniform01()} -
+          Vector::Constant(4.0)};
+
+      spheres.emplace_back(center, radius);
+      pairs.emplace_back(idx, 0U);
+    }
+
+    const auto elements = std::vector<Hexahedron>{hex};
+
+    create_benchmark(
+        "pair_pipeline[per-pair]",
+        [&]() {
+          auto sum = Scalar{0};
+          for (const auto& [sphere_idx, element_idx] : pairs) {
+            sum += overlap_volume(spheres[sphere_idx], elements[element_idx]);
+          }
+
+          ankerl::nanobench::doNotOptimizeAway(sum);
+        },
+        iterations);
+
+    auto statistics = PipelineStatistics{};
+    create_benchmark(
+        "pair_pipeline[staged]",
+        [&]() {
+          const auto results =
+              overlap_volume_pairs(spheres, elements, pairs, &statistics);
+          ankerl::nanobench::doNotOptimizeAway(results);
+        },
+        iterations);
+
+    const auto total = statistics.coarse_time + statistics.containment_time +
+                       statistics.exact_time;
+
+    const auto fraction = [&](const auto time) {
+      return static_cast<double>(time.count()) /
+             static_cast<double>(total.count());
+    };
+
+    MESSAGE("pairs: ", statistics.pairs,
+            ", coarse survivors: ", statistics.coarse_survivors,
+            ", exact: ", statistics.exact_pairs);
+
+    MESSAGE("time fractions: coarse ", fraction(statistics.coarse_time),
+            ", containment ", fraction(statistics.containment_time),
+            ", exact ", fraction(statistics.exact_time));
+  }
+}
@@ -0,0 +1,63 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include <array>
+
+#include <doctest/doctest.h>
+
+#include "overlap/overlap.hpp"
+
+#include "common.hpp"
+
+TEST_SUITE("PyramidOverlap") {
+  using namespace overlap;
+
+  // clang-format off
+  const auto pyramid = Pyramid{{{
+      {-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1}, {0, 0, 1},
+  }}};
+
+  const auto wedge = Wedge{{{
+      {-1, -1, -1}, {1, -1, -1}, {0, 1, -1},
+      {-1, -1,  1}, {1, -1,  1}, {0, 1,  1},
+  }}};
+  // clang-format on
+
+  TEST_CASE("PyramidOverlapVolumeRandomized") {
+    constexpr auto seed = 79'866'982'766'580U;
+    auto rng = ankerl::nanobench::Rng{seed};
+
+    const auto random_sphere = [&rng]() {
+      const auto radius = (2.4 * rng.uniform01()) + 0.1;
+      const auto center = Vector{
+          4.0 * Vector{rng.uniform01(), rng.uniform01(), rng.uniform01()} -
+          Vector::Constant(2.0)};
+
+      return Sphere{center, radius};
+    };
+
+    create_benchmark("pyramid_overlap_volume[random]", [&]() {
+      const auto result = overlap_volume(random_sphere(), pyramid);
+      ankerl::nanobench::doNotOptimizeAway(result);
+    }).epochIterations(25'000);
+
+    auto tets = std::array<Tetrahedron, 2>{};
+    detail::decompose(pyramid, tets);
+
+    create_benchmark("pyramid_overlap_volume[random-decomposed]", [&]() {
+      const auto sphere = random_sphere();
+      const auto result = overlap_volume(sphere, tets[0]) +
+                          overlap_volume(sphere, tets[1]);
+      ankerl::nanobench::doNotOptimizeAway(result);
+    }).epochIterations(25'000);
+
+    create_benchmark("pyramid_overlap_volume[random-wedge]", [&]() {
+      const auto result = overlap_volume(random_sphere(), wedge);
+      ankerl::nanobench::doNotOptimizeAway(result);
+    }).epochIterations(25'000);
+  }
+}
@@ -0,0 +1,109 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "overlap/overlap.hpp"
+
+#include "common.hpp"
+
+TEST_SUITE("SignatureKernels") {
+  using namespace overlap;
+  using detail::IntersectionSignature;
+
+  // clang-format off
+  const auto hex = Hexahedron{{{
+      {-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1},
+      {-1, -1,  1}, {1, -1,  1}, {1, 1,  1}, {-1, 1,  1},
+  }}};
+  // clang-format on
+
+  struct Configuration {
+    Hexahedron element;
+    detail::EntityIntersections<Hexahedron> entities;
+    detail::EdgeIntersections<Hexahedron> edges;
+  };
+
+  TEST_CASE("SignatureKernels") {
+    constexpr auto seed = 79'866'982'766'580U;
+    constexpr auto samples = 10'000U;
+
+    auto rng = ankerl::nanobench::Rng{seed};
+
+    // collect the non-trivial configurations grouped by their signature
+    auto configurations = std::array<std::vector<Configuration>, 3>{};
+    auto trivial = 0U;
+
+    for (auto sample = 0U; sample < samples; ++sample) {
+      const auto radius = (2.4 * rng.uniform01()) + 0.1;
+      const auto center = Vector{
+          4.0 * Vector{rng.uniform01(), rng.uniform01(), rng.uniform01()} -
+          Vector::Constant(2.0)};
+
+      const auto sphere = Sphere{center, radius};
+      if (!detail::intersects_coarse(sphere, hex) ||
+          detail::contains(sphere, hex)) {
+        ++trivial;
+        continue;
+      }
+
+      auto element = detail::normalize_element(sphere, hex);
+      const auto [entities, edges] = detail::unit_sphere_intersections(element);
+
+      if ((entities.faces.none() &&
+           detail::contains(element, Vector::Zero().eval())) ||
+          (entities.vertices.none() && entities.edges.none() &&
+           entities.faces.none())) {
+        ++trivial;
+        continue;
+      }
+
+      const auto signature = detail::intersection_signature(entities);
+      configurations[static_cast<std::size_t>(signature)].push_back(
+          {std::move(element), entities, edges});
+    }
+
+    MESSAGE("trivial: ", trivial, "/", samples);
+
+    const auto names = std::array{"face", "edge", "general"};
+    for (auto idx = 0U; idx < configurations.size(); ++idx) {
+      const auto& configs = configurations[idx];
+      MESSAGE(names[idx], ": ", configs.size(), "/", samples);
+
+      if (configs.empty()) {
+        continue;
+      }
+
+      auto general_idx = std::size_t{0};
+      const auto general = create_benchmark(
+          std::string{"signature_kernels["} + names[idx] + "-general]", [&]() {
+            const auto& config = configs[general_idx++ % configs.size()];
+            const auto result = detail::general_overlap_volume(
+                config.element, config.entities, config.edges);
+            ankerl::nanobench::doNotOptimizeAway(result);
+          });
+
+      auto dispatch_idx = std::size_t{0};
+      const auto dispatch = create_benchmark(
+          std::string{"signature_kernels["} + names[idx] + "-dispatch]", [&]() {
+            const auto& config = configs[dispatch_idx++ % configs.size()];
+            const auto result = detail::unit_overlap_volume(
+                config.element, config.entities, config.edges);
+            ankerl::nanobench::doNotOptimizeAway(result);
+          });
+
+      using Measure = ankerl::nanobench::Result::Measure;
+      MESSAGE(names[idx], " speedup: ",
+              general.results().front().median(Measure::elapsed) /
+                  dispatch.results().front().median(Measure::elapsed));
+    }
+  }
+}
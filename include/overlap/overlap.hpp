@@ -15,16 +15,21 @@
 // C++
 #include <algorithm>
 #include <array>
-#include <bitset>
+#include <chrono>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <iterator>
 #include <limits>
 #include <numeric>
 #include <optional>
 #include <stdexcept>
+#include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #if !defined(overlap_assert)
 #include <cassert>
@@ -35,6 +40,12 @@
 
 namespace overlap {
 
+// Topology of an element type. Specializations for user-defined element types
+// provide the same static tables as the built-in elements, see the section on
+// custom elements in the README for the full list of requirements.
+template<typename T>
+struct element_traits {};
+
 namespace detail {
 
 // type aliases
@@ -219,15 +230,50 @@ inline auto triangle_normal(const Vector& a, const Vector& b, const Vector& c)
   return Vector{yz, zx, xy}.normalized();
 }
 
+// Arithmetic policies used by the building blocks of the overlap calculation.
+// The robust policy relies on overflow-safe norms, extended precision normals
+// and re-orthonormalization of nearly degenerate directions. The fast policy
+// replaces these with plain floating-point operations and is only used in
+// combination with an error estimate, see overlap_volume_estimate().
+struct RobustArithmetic {
+  static constexpr auto orthonormalize = true;
+
+  template<typename Derived>
+  static auto norm(const Eigen::MatrixBase<Derived>& v) -> Scalar {
+    return v.stableNorm();
+  }
+
+  static auto normal(const Vector& a, const Vector& b, const Vector& c)
+      -> Vector {
+    return triangle_normal(a, b, c);
+  }
+};
+
+struct FastArithmetic {
+  static constexpr auto orthonormalize = false;
+
+  template<typename Derived>
+  static auto norm(const Eigen::MatrixBase<Derived>& v) -> Scalar {
+    return v.norm();
+  }
+
+  static auto normal(const Vector& a, const Vector& b, const Vector& c)
+      -> Vector {
+    return ((b - a).cross(c - a)).normalized();
+  }
+};
+
 // Numerically robust routine to calculate the angle between normalized
 // vectors.
 // Ref: http://www.plunk.org/~hatch/rightway.html
+template<typename Arithmetic = RobustArithmetic>
 inline auto angle(const Vector& u, const Vector& v) -> Scalar {
   if (u.dot(v) < Scalar{0}) {
-    return pi - Scalar{2} * std::asin(Scalar{0.5} * (-v - u).stableNorm());
+    return pi -
+           Scalar{2} * std::asin(Scalar{0.5} * Arithmetic::norm(-v - u));
   }
 
-  return Scalar{2} * std::asin(Scalar{0.5} * (v - u).stableNorm());
+  return Scalar{2} * std::asin(Scalar{0.5} * Arithmetic::norm(v - u));
 }
 
 // Orthonormalize two unit vectors using the Gram–Schmidt process, returning
@@ -264,8 +310,38 @@ struct Transformation {
   Scalar scaling = Scalar{1};
 };
 
+// Data shared by all polygons independent of the number of vertices.
+struct PolygonBase {
+  Vector center = Vector::Zero();
+  Vector normal = Vector::Identity();
+  Scalar area = Scalar{0};
+};
+
+// Center of a polygon, given by the centroid of its vertices.
+template<std::size_t VertexCount>
+inline auto polygon_center(const std::array<Vector, VertexCount>& vertices)
+    -> Vector {
+  return (Scalar{1} / Scalar{VertexCount}) *
+         std::accumulate(vertices.begin(), vertices.end(),
+                         Vector::Zero().eval());
+}
+
+// Normal of a polygon with the given center. For a quadrilateral, Newell's
+// method can be simplified significantly.
+// Ref: Christer Ericson - Real-Time Collision Detection (2005)
+template<std::size_t VertexCount>
+inline auto polygon_normal(const std::array<Vector, VertexCount>& vertices,
+                           const Vector& center) -> Vector {
+  if constexpr (VertexCount == 4) {
+    return ((vertices[2] - vertices[0]).cross(vertices[3] - vertices[1]))
+        .normalized();
+  }
+
+  return detail::normal_newell(vertices.begin(), vertices.end(), center);
+}
+
 template<std::size_t VertexCount>
-class Polygon {
+class Polygon : public PolygonBase {
   static_assert(VertexCount >= 3 && VertexCount <= 4,
                 "only triangles and quadrilateral supported");
 
@@ -280,19 +356,8 @@ class Polygon {
 
   explicit Polygon(std::array<Vector, vertex_count> verts) :
       vertices(std::move(verts)) {
-    center = (Scalar{1} / Scalar{vertex_count}) *
-             std::accumulate(vertices.begin(), vertices.end(),
-                             Vector::Zero().eval());
-
-    // For a quadrilateral, Newell's method can be simplified significantly.
-    // Ref: Christer Ericson - Real-Time Collision Detection (2005)
-    if constexpr (vertex_count == 4) {
-      normal = ((vertices[2] - vertices[0]).cross(vertices[3] - vertices[1]))
-                   .normalized();
-
-    } else {
-      normal = detail::normal_newell(vertices.begin(), vertices.end(), center);
-    }
+    center = polygon_center(vertices);
+    normal = polygon_normal(vertices, center);
 
     update_area();
   }
@@ -304,7 +369,9 @@ class Polygon {
 
     center = t.scaling * (center + t.translation);
 
-    update_area();
+    // translation and uniform scaling leave the normal unchanged, while the
+    // area scales quadratically
+    area *= t.scaling * t.scaling;
   }
 
   [[nodiscard]] auto is_planar(const Scalar tolerance = large_epsilon) const
@@ -336,57 +403,179 @@ class Polygon {
 
  public:
   std::array<Vector, VertexCount> vertices = {};
-  Vector center = Vector::Zero();
-  Vector normal = Vector::Identity();
-  Scalar area = Scalar{0};
 };
 
 using Triangle = Polygon<3>;
 using Quadrilateral = Polygon<4>;
 
+// Faces of an element consisting of polygons with differing numbers of
+// vertices. Access by index or iteration yields the data shared by all
+// polygons, like for the std::array of faces of the other elements. The
+// polygons themselves are accessed via get(), and operations requiring the
+// vertices of a face are dispatched via visit().
+template<typename... Polygons>
+class MixedFaces {
+ public:
+  static constexpr std::size_t face_count = sizeof...(Polygons);
+
+  class const_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = PolygonBase;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const PolygonBase*;
+    using reference = const PolygonBase&;
+
+    const_iterator() = default;
+    const_iterator(const MixedFaces* faces, const std::size_t idx) :
+        faces_{faces}, idx_{idx} {}
+
+    [[nodiscard]] auto operator*() const -> reference {
+      return (*faces_)[idx_];
+    }
+
+    [[nodiscard]] auto operator->() const -> pointer { return &**this; }
+
+    auto operator++() -> const_iterator& {
+      ++idx_;
+      return *this;
+    }
+
+    auto operator++(int) -> const_iterator {
+      auto previous = *this;
+      ++idx_;
+      return previous;
+    }
+
+    [[nodiscard]] auto operator==(const const_iterator& other) const -> bool {
+      return faces_ == other.faces_ && idx_ == other.idx_;
+    }
+
+    [[nodiscard]] auto operator!=(const const_iterator& other) const -> bool {
+      return !(*this == other);
+    }
+
+   private:
+    const MixedFaces* faces_ = nullptr;
+    std::size_t idx_ = 0;
+  };
+
+  [[nodiscard]] static constexpr auto size() -> std::size_t {
+    return face_count;
+  }
+
+  [[nodiscard]] auto operator[](const std::size_t idx) const
+      -> const PolygonBase& {
+    return visit(idx, [](const PolygonBase& face) -> const PolygonBase& {
+      return face;
+    });
+  }
+
+  [[nodiscard]] auto begin() const -> const_iterator {
+    return const_iterator{this, 0};
+  }
+
+  [[nodiscard]] auto end() const -> const_iterator {
+    return const_iterator{this, face_count};
+  }
+
+  template<std::size_t Idx>
+  [[nodiscard]] auto get()
+      -> std::tuple_element_t<Idx, std::tuple<Polygons...>>& {
+    return std::get<Idx>(polygons);
+  }
+
+  template<std::size_t Idx>
+  [[nodiscard]] auto get() const
+      -> const std::tuple_element_t<Idx, std::tuple<Polygons...>>& {
+    return std::get<Idx>(polygons);
+  }
+
+  template<std::size_t Idx = 0, typename F>
+  decltype(auto) visit(const std::size_t idx, F&& func) const {
+    if constexpr (Idx + 1 < face_count) {
+      if (idx != Idx) {
+        return visit<Idx + 1>(idx, std::forward<F>(func));
+      }
+    }
+
+    return func(std::get<Idx>(polygons));
+  }
+
+  template<typename F>
+  void for_each(F&& func) {
+    std::apply([&](auto&... polys) { (func(polys), ...); }, polygons);
+  }
+
+  template<typename F>
+  void for_each(F&& func) const {
+    std::apply([&](const auto&... polys) { (func(polys), ...); }, polygons);
+  }
+
+ private:
+  std::tuple<Polygons...> polygons;
+};
+
+template<typename Faces>
+struct face_count : public std::tuple_size<Faces> {};
+
+template<typename... Polygons>
+struct face_count<MixedFaces<Polygons...>>
+    : public std::integral_constant<std::size_t, sizeof...(Polygons)> {};
+
+template<typename Polygon, std::size_t N, typename F>
+decltype(auto) visit(const std::array<Polygon, N>& faces,
+                     const std::size_t idx, F&& func) {
+  return func(faces[idx]);
+}
+
+template<typename... Polygons, typename F>
+decltype(auto) visit(const MixedFaces<Polygons...>& faces,
+                     const std::size_t idx, F&& func) {
+  return faces.visit(idx, std::forward<F>(func));
+}
+
 // Forward declarations of the mesh elements.
 class Tetrahedron;
 class Wedge;
 class Hexahedron;
+class Pyramid;
 
-// Some tricks are required to keep this code header-only.
-template<typename T, typename Nil>
-struct mappings;
+// Topology tables of the mesh elements. As constexpr static members, they are
+// implicitly inline and usable in constant expressions. The tables of
+// user-defined element types are taken from their element traits.
+template<typename T>
+struct mappings : public element_traits<T> {};
 
-template<typename Nil>
-struct mappings<Tetrahedron, Nil> {
+template<>
+struct mappings<Tetrahedron> {
   // Map edges of a tetrahedron to vertices and faces.
-  static const uint32_t edge_mapping[6][2][2];
+  static constexpr uint32_t edge_mapping[6][2][2] = {
+      {{0, 1}, {0, 1}}, {{1, 2}, {0, 2}}, {{2, 0}, {0, 3}},
+      {{0, 3}, {1, 3}}, {{1, 3}, {1, 2}}, {{2, 3}, {2, 3}}};
 
   // Map vertices of a tetrahedron to edges and faces.
   // 0: local IDs of the edges intersecting at this vertex
   // 1: 0 if the edge is pointing away from the vertex, 1 otherwise
   // 2: faces joining at the vertex
-  static const uint32_t vertex_mapping[4][3][3];
+  static constexpr uint32_t vertex_mapping[4][3][3] = {
+      {{0, 2, 3}, {0, 1, 0}, {0, 1, 3}},
+      {{0, 1, 4}, {1, 0, 0}, {0, 1, 2}},
+      {{1, 2, 5}, {1, 0, 0}, {0, 2, 3}},
+      {{3, 4, 5}, {1, 1, 1}, {1, 3, 2}}};
 
   // This mapping contains the three sets of the two edges for each of the
   // faces joining at a vertex. The indices are mapped to the local edge IDs
   // using the first value field of the 'vertex_mapping' table.
-  static const uint32_t face_mapping[3][2];
-};
-
-template<typename Nil>
-const uint32_t mappings<Tetrahedron, Nil>::edge_mapping[6][2][2] = {
-    {{0, 1}, {0, 1}}, {{1, 2}, {0, 2}}, {{2, 0}, {0, 3}},
-    {{0, 3}, {1, 3}}, {{1, 3}, {1, 2}}, {{2, 3}, {2, 3}}};
+  static constexpr uint32_t face_mapping[3][2] = {{0, 1}, {0, 2}, {1, 2}};
 
-template<typename Nil>
-const uint32_t mappings<Tetrahedron, Nil>::vertex_mapping[4][3][3] = {
-    {{0, 2, 3}, {0, 1, 0}, {0, 1, 3}},
-    {{0, 1, 4}, {1, 0, 0}, {0, 1, 2}},
-    {{1, 2, 5}, {1, 0, 0}, {0, 2, 3}},
-    {{3, 4, 5}, {1, 1, 1}, {1, 3, 2}}};
-
-template<typename Nil>
-const uint32_t mappings<Tetrahedron, Nil>::face_mapping[3][2] = {
-    {0, 1}, {0, 2}, {1, 2}};
+  // Map faces of a tetrahedron to their vertices.
+  static constexpr uint32_t face_vertex_mapping[4][3] = {
+      {2, 1, 0}, {0, 1, 3}, {1, 2, 3}, {2, 0, 3}};
+  static constexpr uint32_t face_vertex_count[4] = {3, 3, 3, 3};
+};
 
-using tet_mappings = mappings<Tetrahedron, void>;
+using tet_mappings = mappings<Tetrahedron>;
 
 class Tetrahedron : public tet_mappings {
  public:
@@ -421,7 +610,7 @@ class Tetrahedron : public tet_mappings {
     center = Scalar{0.25} * std::accumulate(vertices.begin(), vertices.end(),
                                             Vector::Zero().eval());
 
-    volume = calc_volume();
+    volume *= t.scaling * t.scaling * t.scaling;
   }
 
   [[nodiscard]] auto surface_area() const -> Scalar {
@@ -430,6 +619,15 @@ class Tetrahedron : public tet_mappings {
         [](auto sum, const auto& face) { return sum + face.area; });
   }
 
+  // Volume of the element with the given vertices.
+  [[nodiscard]] static auto calc_volume(const std::array<Vector, 4>& vertices)
+      -> Scalar {
+    return (Scalar{1} / Scalar{6}) *
+           std::abs((vertices[0] - vertices[3])
+                        .dot((vertices[1] - vertices[3])
+                                 .cross(vertices[2] - vertices[3])));
+  }
+
  private:
   void init() {
     // 0: v2, v1, v0
@@ -447,14 +645,7 @@ class Tetrahedron : public tet_mappings {
     center = Scalar{0.25} * std::accumulate(vertices.begin(), vertices.end(),
                                             Vector::Zero().eval());
 
-    volume = calc_volume();
-  }
-
-  [[nodiscard]] auto calc_volume() const -> Scalar {
-    return (Scalar{1} / Scalar{6}) *
-           std::abs((vertices[0] - vertices[3])
-                        .dot((vertices[1] - vertices[3])
-                                 .cross(vertices[2] - vertices[3])));
+    volume = calc_volume(vertices);
   }
 
  public:
@@ -464,46 +655,43 @@ class Tetrahedron : public tet_mappings {
   Scalar volume = Scalar{0};
 };
 
-template<typename Nil>
-struct mappings<Wedge, Nil> {
+template<>
+struct mappings<Wedge> {
   // Map edges of a wedge to vertices and faces.
-  static const uint32_t edge_mapping[9][2][2];
+  static constexpr uint32_t edge_mapping[9][2][2] = {
+      {{0, 1}, {0, 1}}, {{1, 2}, {0, 2}}, {{2, 0}, {0, 3}},
+      {{0, 3}, {1, 3}}, {{1, 4}, {1, 2}}, {{2, 5}, {2, 3}},
+      {{3, 4}, {1, 4}}, {{4, 5}, {2, 4}}, {{5, 3}, {3, 4}}};
 
   // Map vertices of a wedge to edges and faces.
   // 0: local IDs of the edges intersecting at this vertex
   // 1: 0 if the edge is pointing away from the vertex, 1 otherwise
   // 2: faces joining at the vertex
-  static const uint32_t vertex_mapping[6][3][3];
+  // clang-format off
+  static constexpr uint32_t vertex_mapping[6][3][3] = {
+      {{0, 2, 3}, {0, 1, 0}, {0, 1, 3}},
+      {{0, 1, 4}, {1, 0, 0}, {0, 1, 2}},
+      {{1, 2, 5}, {1, 0, 0}, {0, 2, 3}},
+
+      {{3, 6, 8}, {1, 0, 1}, {1, 3, 4}},
+      {{4, 6, 7}, {1, 1, 0}, {1, 2, 4}},
+      {{5, 7, 8}, {1, 1, 0}, {2, 3, 4}}};
+  // clang-format on
 
   // This mapping contains the three sets of the two edges for each of the
   // faces joining at a vertex. The indices are mapped to the local edge IDs
   // using the first value field of the 'vertex_mapping' table.
-  static const uint32_t face_mapping[3][2];
+  static constexpr uint32_t face_mapping[3][2] = {{0, 1}, {0, 2}, {1, 2}};
+
+  // Map faces of a wedge to their vertices. The rows of the triangular faces
+  // are padded by repeating their first vertex, the number of vertices of each
+  // face is provided by 'face_vertex_count'.
+  static constexpr uint32_t face_vertex_mapping[5][4] = {
+      {2, 1, 0, 2}, {0, 1, 4, 3}, {1, 2, 5, 4}, {2, 0, 3, 5}, {3, 4, 5, 3}};
+  static constexpr uint32_t face_vertex_count[5] = {3, 4, 4, 4, 3};
 };
 
-template<typename Nil>
-const uint32_t mappings<Wedge, Nil>::edge_mapping[9][2][2] = {
-    {{0, 1}, {0, 1}}, {{1, 2}, {0, 2}}, {{2, 0}, {0, 3}},
-    {{0, 3}, {1, 3}}, {{1, 4}, {1, 2}}, {{2, 5}, {2, 3}},
-    {{3, 4}, {1, 4}}, {{4, 5}, {2, 4}}, {{5, 3}, {3, 4}}};
-
-// clang-format off
-template<typename Nil>
-const uint32_t mappings<Wedge, Nil>::vertex_mapping[6][3][3] = {
-    {{0, 2, 3}, {0, 1, 0}, {0, 1, 3}},
-    {{0, 1, 4}, {1, 0, 0}, {0, 1, 2}},
-    {{1, 2, 5}, {1, 0, 0}, {0, 2, 3}},
-
-    {{3, 6, 8}, {1, 0, 1}, {1, 3, 4}},
-    {{4, 6, 7}, {1, 1, 0}, {1, 2, 4}},
-    {{5, 7, 8}, {1, 1, 0}, {2, 3, 4}}};
-// clang-format on
-
-template<typename Nil>
-const uint32_t mappings<Wedge, Nil>::face_mapping[3][2] = {
-    {0, 1}, {0, 2}, {1, 2}};
-
-using wedge_mappings = mappings<Wedge, void>;
+using wedge_mappings = mappings<Wedge>;
 
 class Wedge : public wedge_mappings {
  public:
@@ -523,126 +711,119 @@ class Wedge : public wedge_mappings {
       v = t.scaling * (v + t.translation);
     }
 
-    for (auto& f : faces) {
-      f.apply(t);
-    }
+    faces.for_each([&](auto& f) { f.apply(t); });
 
     center = (Scalar{1} / Scalar{6}) * std::accumulate(vertices.begin(),
                                                        vertices.end(),
                                                        Vector::Zero().eval());
 
-    volume = calc_volume();
+    volume *= t.scaling * t.scaling * t.scaling;
   }
 
   [[nodiscard]] auto surface_area() const -> Scalar {
-    return std::accumulate(
-        std::begin(faces), std::end(faces), Scalar{0},
-        [](auto sum, const auto& face) { return sum + face.area; });
+    auto area = Scalar{0};
+    faces.for_each([&](const auto& face) { area += face.area; });
+
+    return area;
+  }
+
+  // Volume of the element with the given vertices.
+  [[nodiscard]] static auto calc_volume(const std::array<Vector, 6>& vertices)
+      -> Scalar {
+    // The wedge is decomposed into the three tetrahedra (v0, v1, v2, v3),
+    // (v1, v2, v3, v4) and (v2, v3, v4, v5).
+    auto sum = Scalar{0};
+    for (auto idx = 0u; idx < 3u; ++idx) {
+      const auto& v0 = vertices[idx];
+      sum += (vertices[idx + 1] - v0)
+                 .dot((vertices[idx + 2] - v0).cross(vertices[idx + 3] - v0));
+    }
+
+    return (Scalar{1} / Scalar{6}) * sum;
   }
 
  private:
   void init() {
-    // All faces of the wedge are stored as quadrilaterals, so an
-    // additional point is inserted between v0 and v1.
-    // 0: v2, v1, v0, v02
-    faces[0] = Quadrilateral(vertices[2], vertices[1], vertices[0],
-                             Scalar{0.5} * (vertices[0] + vertices[2]));
+    // 0: v2, v1, v0
+    faces.get<0>() = Triangle(vertices[2], vertices[1], vertices[0]);
 
     // 1: v0, v1, v4, v3
-    faces[1] =
+    faces.get<1>() =
         Quadrilateral(vertices[0], vertices[1], vertices[4], vertices[3]);
 
     // 2: v1, v2, v5, v4
-    faces[2] =
+    faces.get<2>() =
         Quadrilateral(vertices[1], vertices[2], vertices[5], vertices[4]);
 
     // 3: v2, v0, v3, v5
-    faces[3] =
+    faces.get<3>() =
         Quadrilateral(vertices[2], vertices[0], vertices[3], vertices[5]);
 
-    // All faces of the wedge are stored as quadrilaterals, so an
-    // additional point is inserted between v3 and v5.
-    // 4: v3, v4, v5, v53
-    faces[4] = Quadrilateral(vertices[3], vertices[4], vertices[5],
-                             Scalar{0.5} * (vertices[5] + vertices[3]));
+    // 4: v3, v4, v5
+    faces.get<4>() = Triangle(vertices[3], vertices[4], vertices[5]);
 
     center = (Scalar{1} / Scalar{6}) * std::accumulate(vertices.begin(),
                                                        vertices.end(),
                                                        Vector::Zero().eval());
 
-    volume = calc_volume();
-  }
-
-  [[nodiscard]] auto calc_volume() const -> Scalar {
-    // The wedge is treated as a degenerate hexahedron here by adding
-    // two fake vertices v02 and v35.
-    const Vector diagonal = vertices[5] - vertices[0];
-
-    return (Scalar{1} / Scalar{6}) *
-           (diagonal.dot(
-               ((vertices[1] - vertices[0]).cross(vertices[2] - vertices[4])) +
-               ((vertices[3] - vertices[0])
-                    .cross(vertices[4] -
-                           Scalar{0.5} * (vertices[3] + vertices[5]))) +
-               ((Scalar{0.5} * (vertices[0] + vertices[2]) - vertices[0])
-                    .cross(Scalar{0.5} * (vertices[3] + vertices[5]) -
-                           vertices[2]))));
+    volume = calc_volume(vertices);
   }
 
  public:
   std::array<Vector, 6> vertices;
-  std::array<Quadrilateral, 5> faces = {};
+  MixedFaces<Triangle, Quadrilateral, Quadrilateral, Quadrilateral, Triangle>
+      faces;
   Vector center = Vector::Zero();
   Scalar volume = Scalar{0};
 };
 
-template<typename Nil>
-struct mappings<Hexahedron, Nil> {
+template<>
+struct mappings<Hexahedron> {
   // Map edges of a hexahedron to vertices and faces.
-  static const uint32_t edge_mapping[12][2][2];
+  // clang-format off
+  static constexpr uint32_t edge_mapping[12][2][2] = {
+      {{0, 1}, {0, 1}}, {{1, 2}, {0, 2}},
+      {{2, 3}, {0, 3}}, {{3, 0}, {0, 4}},
+
+      {{0, 4}, {1, 4}}, {{1, 5}, {1, 2}},
+      {{2, 6}, {2, 3}}, {{3, 7}, {3, 4}},
+
+      {{4, 5}, {1, 5}}, {{5, 6}, {2, 5}},
+      {{6, 7}, {3, 5}}, {{7, 4}, {4, 5}}};
+  // clang-format on
 
   // Map vertices of a hexahedron to edges and faces.
   // 0: local IDs of the edges intersecting at this vertex
   // 1: 0 if the edge is pointing away from the vertex, 1 otherwise
   // 2: faces joining at the vertex
-  static const uint32_t vertex_mapping[8][3][3];
+  // clang-format off
+  static constexpr uint32_t vertex_mapping[8][3][3] = {
+      {{0, 3, 4}, {0, 1, 0}, {0, 1, 4}},
+      {{0, 1, 5}, {1, 0, 0}, {0, 1, 2}},
+      {{1, 2, 6}, {1, 0, 0}, {0, 2, 3}},
+      {{2, 3, 7}, {1, 0, 0}, {0, 3, 4}},
+
+      {{4, 8, 11}, {1, 0, 1}, {1, 4, 5}},
+      {{5, 8, 9}, {1, 1, 0}, {1, 2, 5}},
+      {{6, 9, 10}, {1, 1, 0}, {2, 3, 5}},
+      {{7, 10, 11}, {1, 1, 0}, {3, 4, 5}}};
+  // clang-format on
 
   // This mapping contains the three sets of the two edges for each of the
   // faces joining at a vertex. The indices are mapped to the local edge IDs
   // using the first value field of the 'vertex_mapping' table.
-  static const uint32_t face_mapping[3][2];
+  static constexpr uint32_t face_mapping[3][2] = {{0, 1}, {0, 2}, {1, 2}};
+
+  // Map faces of a hexahedron to their vertices.
+  // clang-format off
+  static constexpr uint32_t face_vertex_mapping[6][4] = {
+      {3, 2, 1, 0}, {0, 1, 5, 4}, {1, 2, 6, 5},
+      {2, 3, 7, 6}, {3, 0, 4, 7}, {4, 5, 6, 7}};
+  // clang-format on
+  static constexpr uint32_t face_vertex_count[6] = {4, 4, 4, 4, 4, 4};
 };
 
-// clang-format off
-template<typename Nil>
-const uint32_t mappings<Hexahedron, Nil>::edge_mapping[12][2][2] = {
-    {{0, 1}, {0, 1}}, {{1, 2}, {0, 2}},
-    {{2, 3}, {0, 3}}, {{3, 0}, {0, 4}},
-
-    {{0, 4}, {1, 4}}, {{1, 5}, {1, 2}},
-    {{2, 6}, {2, 3}}, {{3, 7}, {3, 4}},
-
-    {{4, 5}, {1, 5}}, {{5, 6}, {2, 5}},
-    {{6, 7}, {3, 5}}, {{7, 4}, {4, 5}}};
-
-template<typename Nil>
-const uint32_t mappings<Hexahedron, Nil>::vertex_mapping[8][3][3] = {
-    {{0, 3, 4}, {0, 1, 0}, {0, 1, 4}},
-    {{0, 1, 5}, {1, 0, 0}, {0, 1, 2}},
-    {{1, 2, 6}, {1, 0, 0}, {0, 2, 3}},
-    {{2, 3, 7}, {1, 0, 0}, {0, 3, 4}},
-
-    {{4, 8, 11}, {1, 0, 1}, {1, 4, 5}},
-    {{5, 8, 9}, {1, 1, 0}, {1, 2, 5}},
-    {{6, 9, 10}, {1, 1, 0}, {2, 3, 5}},
-    {{7, 10, 11}, {1, 1, 0}, {3, 4, 5}}};
-// clang-format on
-
-template<typename Nil>
-const uint32_t mappings<Hexahedron, Nil>::face_mapping[3][2] = {
-    {0, 1}, {0, 2}, {1, 2}};
-
-using hex_mappings = mappings<Hexahedron, void>;
+using hex_mappings = mappings<Hexahedron>;
 
 class Hexahedron : public hex_mappings {
  public:
@@ -672,7 +853,7 @@ class Hexahedron : public hex_mappings {
                                                        vertices.end(),
                                                        Vector::Zero().eval());
 
-    volume = calc_volume();
+    volume *= t.scaling * t.scaling * t.scaling;
   }
 
   [[nodiscard]] auto surface_area() const -> Scalar {
@@ -681,6 +862,18 @@ class Hexahedron : public hex_mappings {
         [](auto sum, const auto& face) { return sum + face.area; });
   }
 
+  // Volume of the element with the given vertices.
+  [[nodiscard]] static auto calc_volume(const std::array<Vector, 8>& vertices)
+      -> Scalar {
+    const auto diagonal = vertices[6] - vertices[0];
+
+    return (Scalar{1} / Scalar{6}) *
+           diagonal.dot(
+               ((vertices[1] - vertices[0]).cross(vertices[2] - vertices[5])) +
+               ((vertices[4] - vertices[0]).cross(vertices[5] - vertices[7])) +
+               ((vertices[3] - vertices[0]).cross(vertices[7] - vertices[2])));
+  }
+
  private:
   void init() {
     // 0: v3, v2, v1, v0
@@ -711,63 +904,234 @@ class Hexahedron : public hex_mappings {
                                                        vertices.end(),
                                                        Vector::Zero().eval());
 
-    volume = calc_volume();
+    volume = calc_volume(vertices);
   }
 
-  [[nodiscard]] auto calc_volume() const -> Scalar {
-    const auto diagonal = vertices[6] - vertices[0];
+ public:
+  std::array<Vector, 8> vertices = {};
+  std::array<Quadrilateral, 6> faces = {};
+  Vector center = Vector::Zero();
+  Scalar volume = Scalar{0};
+};
+
+template<>
+struct mappings<Pyramid> {
+  // Map edges of a pyramid to vertices and faces.
+  static constexpr uint32_t edge_mapping[8][2][2] = {
+      {{0, 1}, {0, 1}}, {{1, 2}, {0, 2}}, {{2, 3}, {0, 3}}, {{3, 0}, {0, 4}},
+      {{0, 4}, {1, 4}}, {{1, 4}, {1, 2}}, {{2, 4}, {2, 3}}, {{3, 4}, {3, 4}}};
+
+  // Map vertices of a pyramid to edges and faces.
+  // 0: local IDs of the edges intersecting at this vertex
+  // 1: 0 if the edge is pointing away from the vertex, 1 otherwise
+  // 2: faces joining at the vertex
+  // Note: Only the vertices of the base are covered, as the apex joins four
+  // edges and faces.
+  // clang-format off
+  static constexpr uint32_t vertex_mapping[4][3][3] = {
+      {{0, 3, 4}, {0, 1, 0}, {0, 1, 4}},
+      {{0, 1, 5}, {1, 0, 0}, {0, 1, 2}},
+      {{1, 2, 6}, {1, 0, 0}, {0, 2, 3}},
+      {{2, 3, 7}, {1, 0, 0}, {0, 3, 4}}};
+  // clang-format on
+
+  // This mapping contains the three sets of the two edges for each of the
+  // faces joining at a vertex. The indices are mapped to the local edge IDs
+  // using the first value field of the 'vertex_mapping' table.
+  static constexpr uint32_t face_mapping[3][2] = {{0, 1}, {0, 2}, {1, 2}};
+
+  // Map faces of a pyramid to their vertices. The rows of the triangular
+  // faces are padded by repeating their first vertex, the number of vertices
+  // of each face is provided by 'face_vertex_count'.
+  static constexpr uint32_t face_vertex_mapping[5][4] = {
+      {0, 3, 2, 1}, {0, 1, 4, 0}, {1, 2, 4, 1}, {2, 3, 4, 2}, {3, 0, 4, 3}};
+  static constexpr uint32_t face_vertex_count[5] = {4, 3, 3, 3, 3};
+
+  // Index of the apex of the pyramid.
+  static constexpr uint32_t apex = 4;
+};
+
+using pyramid_mappings = mappings<Pyramid>;
+
+class Pyramid : public pyramid_mappings {
+ public:
+  Pyramid() {
+    std::fill(std::begin(vertices), std::end(vertices), Vector::Zero());
+  }
+
+  template<typename... Types>
+  Pyramid(const Vector& v0, Types... verts) : vertices{{v0, verts...}} {
+    init();
+  }
+
+  Pyramid(std::array<Vector, 5> verts) : vertices{std::move(verts)} { init(); }
+
+  void apply(const Transformation& t) {
+    for (auto& v : vertices) {
+      v = t.scaling * (v + t.translation);
+    }
+
+    faces.for_each([&](auto& f) { f.apply(t); });
+
+    center = (Scalar{1} / Scalar{5}) * std::accumulate(vertices.begin(),
+                                                       vertices.end(),
+                                                       Vector::Zero().eval());
+
+    volume *= t.scaling * t.scaling * t.scaling;
+  }
+
+  [[nodiscard]] auto surface_area() const -> Scalar {
+    auto area = Scalar{0};
+    faces.for_each([&](const auto& face) { area += face.area; });
+
+    return area;
+  }
+
+  // Volume of the element with the given vertices.
+  [[nodiscard]] static auto calc_volume(const std::array<Vector, 5>& vertices)
+      -> Scalar {
+    // The pyramid is decomposed into the two tetrahedra (v0, v1, v2, v4) and
+    // (v0, v2, v3, v4).
+    const auto& v0 = vertices[0];
+    const Vector apex_dir = vertices[4] - v0;
 
     return (Scalar{1} / Scalar{6}) *
-           diagonal.dot(
-               ((vertices[1] - vertices[0]).cross(vertices[2] - vertices[5])) +
-               ((vertices[4] - vertices[0]).cross(vertices[5] - vertices[7])) +
-               ((vertices[3] - vertices[0]).cross(vertices[7] - vertices[2])));
+           ((vertices[1] - v0).dot((vertices[2] - v0).cross(apex_dir)) +
+            (vertices[2] - v0).dot((vertices[3] - v0).cross(apex_dir)));
+  }
+
+ private:
+  void init() {
+    // 0: v0, v3, v2, v1
+    faces.get<0>() =
+        Quadrilateral(vertices[0], vertices[3], vertices[2], vertices[1]);
+
+    // 1: v0, v1, v4
+    faces.get<1>() = Triangle(vertices[0], vertices[1], vertices[4]);
+
+    // 2: v1, v2, v4
+    faces.get<2>() = Triangle(vertices[1], vertices[2], vertices[4]);
+
+    // 3: v2, v3, v4
+    faces.get<3>() = Triangle(vertices[2], vertices[3], vertices[4]);
+
+    // 4: v3, v0, v4
+    faces.get<4>() = Triangle(vertices[3], vertices[0], vertices[4]);
+
+    center = (Scalar{1} / Scalar{5}) * std::accumulate(vertices.begin(),
+                                                       vertices.end(),
+                                                       Vector::Zero().eval());
+
+    volume = calc_volume(vertices);
   }
 
  public:
-  std::array<Vector, 8> vertices = {};
-  std::array<Quadrilateral, 6> faces = {};
+  std::array<Vector, 5> vertices;
+  MixedFaces<Quadrilateral, Triangle, Triangle, Triangle, Triangle> faces;
   Vector center = Vector::Zero();
   Scalar volume = Scalar{0};
 };
 
 template<typename Element>
-constexpr auto num_vertices() -> std::size_t {
-  return std::tuple_size_v<decltype(Element::vertices)>;
+class CompactElement;
+
+template<typename Table, std::size_t... Extents, std::size_t... Dims>
+constexpr auto has_extents_impl(std::index_sequence<Dims...> /*unused*/)
+    -> bool {
+  return std::rank_v<Table> == sizeof...(Extents) &&
+         ((std::extent_v<Table, Dims> == Extents) && ...);
 }
 
-template<typename Element>
-constexpr auto num_faces() -> std::size_t {
-  return std::tuple_size_v<decltype(Element::faces)>;
+// check the dimensions of a (multi-dimensional) array type
+template<typename Table, std::size_t... Extents>
+constexpr auto has_extents() -> bool {
+  return has_extents_impl<Table, Extents...>(
+      std::make_index_sequence<sizeof...(Extents)>{});
 }
 
-template<typename Element>
-constexpr auto num_edges() -> std::size_t {
-  if constexpr (std::is_same_v<Element, Hexahedron>) {
-    return 12U;
-  }
+// A user-defined element type derives from its element traits and has the
+// same data members as the built-in elements. As the corrections at the
+// vertices assume three edges joining at each vertex, the vertex mapping has to
+// cover all vertices.
+template<typename T, typename = void>
+struct is_custom_element : public std::false_type {};
 
-  if constexpr (std::is_same_v<Element, Wedge>) {
-    return 9U;
-  }
+template<typename T>
+struct is_custom_element<
+    T, std::void_t<decltype(T::vertices), decltype(T::faces),
+                   decltype(T::center), decltype(T::volume),
+                   decltype(std::declval<T&>().apply(Transformation{})),
+                   decltype(std::declval<const T&>().surface_area()),
+                   decltype(element_traits<T>::edge_mapping),
+                   decltype(element_traits<T>::vertex_mapping),
+                   decltype(element_traits<T>::face_mapping),
+                   decltype(element_traits<T>::face_vertex_mapping),
+                   decltype(element_traits<T>::face_vertex_count)>> {
+ private:
+  using Traits = element_traits<T>;
 
-  if constexpr (std::is_same_v<Element, Tetrahedron>) {
-    return 6U;
-  }
+  static constexpr auto vertices = std::tuple_size_v<decltype(T::vertices)>;
+  static constexpr auto faces = face_count<decltype(T::faces)>::value;
+  static constexpr auto edges = std::extent_v<decltype(Traits::edge_mapping)>;
+  static constexpr auto max_face_vertices =
+      std::extent_v<decltype(Traits::face_vertex_mapping), 1>;
 
-  // older versions of GCC cannot handle exceptions in constexpr contexts
-  return std::numeric_limits<std::size_t>::max();
-}
+ public:
+  static constexpr bool value =
+      std::is_base_of_v<Traits, T> &&
+      std::is_same_v<decltype(T::vertices), std::array<Vector, vertices>> &&
+      has_extents<decltype(Traits::edge_mapping), edges, 2, 2>() &&
+      has_extents<decltype(Traits::vertex_mapping), vertices, 3, 3>() &&
+      has_extents<decltype(Traits::face_mapping), 3, 2>() &&
+      has_extents<decltype(Traits::face_vertex_mapping), faces,
+                  max_face_vertices>() &&
+      has_extents<decltype(Traits::face_vertex_count), faces>();
+};
 
 template<typename T>
 struct is_element
     : public std::integral_constant<bool, std::is_same_v<T, Tetrahedron> ||
                                               std::is_same_v<T, Wedge> ||
-                                              std::is_same_v<T, Hexahedron>> {};
+                                              std::is_same_v<T, Hexahedron> ||
+                                              std::is_same_v<T, Pyramid> ||
+                                              is_custom_element<T>::value> {};
+
+template<typename Element>
+struct is_element<CompactElement<Element>> : public is_element<Element> {};
 
 template<typename T>
 inline constexpr bool is_element_v = is_element<T>::value;
 
+// Note: The number of entities is only defined for element types, allowing
+// the use in the signature of overloaded functions.
+template<typename Element>
+constexpr auto num_vertices() -> std::size_t {
+  if constexpr (is_element_v<Element>) {
+    return std::tuple_size_v<decltype(Element::vertices)>;
+  }
+
+  return 0;
+}
+
+template<typename Element>
+constexpr auto num_faces() -> std::size_t {
+  if constexpr (is_element_v<Element>) {
+    return face_count<decltype(Element::faces)>::value;
+  }
+
+  return 0;
+}
+
+template<typename Element>
+constexpr auto num_edges() -> std::size_t {
+  if constexpr (is_element_v<Element>) {
+    return std::extent_v<decltype(Element::edge_mapping), 0>;
+  }
+
+  // older versions of GCC cannot handle exceptions in constexpr contexts
+  return std::numeric_limits<std::size_t>::max();
+}
+
 class Sphere {
  public:
   Sphere() : Sphere{Vector::Zero(), Scalar{1}} {}
@@ -823,596 +1187,1434 @@ struct Plane {
   Vector normal;
 };
 
-// Decomposition of a tetrahedron into 4 tetrahedra.
-inline void decompose(const Tetrahedron& tet,
-                      std::array<Tetrahedron, 4>& tets) {
-  tets[0] = Tetrahedron(tet.vertices[0], tet.vertices[1], tet.vertices[2],
-                        tet.center);
+// Compact representation of a mesh element storing only the vertices and the
+// planes of the faces, defined by the face centers and normals. Compared to
+// the full element, the vertices of the faces are not duplicated. Data rarely
+// needed such as the areas of the faces are derived on demand.
+template<typename Element>
+class CompactElement : public mappings<Element> {
+  static_assert(is_element_v<Element>, "invalid element type detected");
 
-  tets[1] = Tetrahedron(tet.vertices[0], tet.vertices[1], tet.center,
-                        tet.vertices[3]);
+ public:
+  static constexpr auto vertex_count = num_vertices<Element>();
+  static constexpr auto face_count = num_faces<Element>();
 
-  tets[2] = Tetrahedron(tet.vertices[1], tet.vertices[2], tet.center,
-                        tet.vertices[3]);
-
-  tets[3] = Tetrahedron(tet.vertices[2], tet.vertices[0], tet.center,
-                        tet.vertices[3]);
-}
-
-// Decomposition of a hexahedron into 2 wedges.
-inline void decompose(const Hexahedron& hex, std::array<Wedge, 2>& wedges) {
-  wedges[0] = Wedge(hex.vertices[0], hex.vertices[1], hex.vertices[2],
-                    hex.vertices[4], hex.vertices[5], hex.vertices[6]);
-
-  wedges[1] = Wedge(hex.vertices[0], hex.vertices[2], hex.vertices[3],
-                    hex.vertices[4], hex.vertices[6], hex.vertices[7]);
-}
-
-// Decomposition of a hexahedron into 5 tetrahedra.
-inline void decompose(const Hexahedron& hex, std::array<Tetrahedron, 5>& tets) {
-  tets[0] = Tetrahedron(hex.vertices[0], hex.vertices[1], hex.vertices[2],
-                        hex.vertices[5]);
+  CompactElement() {
+    std::fill(std::begin(vertices), std::end(vertices), Vector::Zero());
+    std::fill(std::begin(faces), std::end(faces),
+              Plane{Vector::Zero(), Vector::Zero()});
+  }
 
-  tets[1] = Tetrahedron(hex.vertices[0], hex.vertices[2], hex.vertices[7],
-                        hex.vertices[5]);
+  explicit CompactElement(const Element& element) :
+      vertices{element.vertices},
+      center{element.center},
+      volume{element.volume} {
+    for (auto face_idx = 0u; face_idx < face_count; ++face_idx) {
+      faces[face_idx] =
+          Plane{element.faces[face_idx].center, element.faces[face_idx].normal};
+    }
+  }
 
-  tets[2] = Tetrahedron(hex.vertices[0], hex.vertices[2], hex.vertices[3],
-                        hex.vertices[7]);
+  // Compact representation set up directly from the vertices, only the
+  // planes of the faces are computed. Custom element types are created in
+  // full first, as their volume is only known to the element itself.
+  explicit CompactElement(std::array<Vector, vertex_count> verts) {
+    if constexpr (is_custom_element<Element>::value) {
+      *this = CompactElement{Element{std::move(verts)}};
+    } else {
+      // all faces of a tetrahedron are triangles
+      constexpr auto max_face_vertices =
+          std::extent_v<decltype(Element::face_vertex_mapping), 1>;
+
+      vertices = std::move(verts);
+      for (auto face_idx = 0u; face_idx < face_count; ++face_idx) {
+        if constexpr (max_face_vertices == 3u) {
+          faces[face_idx] = face_plane<3>(face_idx);
+        } else {
+          faces[face_idx] = Element::face_vertex_count[face_idx] == 3u
+                                ? face_plane<3>(face_idx)
+                                : face_plane<4>(face_idx);
+        }
+      }
 
-  tets[3] = Tetrahedron(hex.vertices[0], hex.vertices[5], hex.vertices[7],
-                        hex.vertices[4]);
+      center = polygon_center(vertices);
+      volume = Element::calc_volume(vertices);
+    }
+  }
 
-  tets[4] = Tetrahedron(hex.vertices[2], hex.vertices[7], hex.vertices[5],
-                        hex.vertices[6]);
-}
+  // Compact representation of the transformed element, created without
+  // transforming the full element first.
+  CompactElement(const Element& element, const Transformation& t) :
+      center{t.scaling * (element.center + t.translation)},
+      volume{t.scaling * t.scaling * t.scaling * element.volume} {
+    for (auto idx = 0u; idx < vertex_count; ++idx) {
+      vertices[idx] = t.scaling * (element.vertices[idx] + t.translation);
+    }
 
-// Decomposition of a hexahedron into 6 tetrahedra.
-inline void decompose(const Hexahedron& hex, std::array<Tetrahedron, 6>& tets) {
-  tets[0] = Tetrahedron(hex.vertices[0], hex.vertices[5], hex.vertices[7],
-                        hex.vertices[4]);
+    for (auto face_idx = 0u; face_idx < face_count; ++face_idx) {
+      const auto& face = element.faces[face_idx];
+      faces[face_idx] =
+          Plane{t.scaling * (face.center + t.translation), face.normal};
+    }
+  }
 
-  tets[1] = Tetrahedron(hex.vertices[0], hex.vertices[1], hex.vertices[7],
-                        hex.vertices[5]);
+  // Translation and uniform scaling leave the face normals unchanged.
+  void apply(const Transformation& t) {
+    for (auto& v : vertices) {
+      v = t.scaling * (v + t.translation);
+    }
 
-  tets[2] = Tetrahedron(hex.vertices[1], hex.vertices[6], hex.vertices[7],
-                        hex.vertices[5]);
+    for (auto& f : faces) {
+      f.center = t.scaling * (f.center + t.translation);
+    }
 
-  tets[3] = Tetrahedron(hex.vertices[0], hex.vertices[7], hex.vertices[2],
-                        hex.vertices[3]);
+    center = t.scaling * (center + t.translation);
+    volume *= t.scaling * t.scaling * t.scaling;
+  }
 
-  tets[4] = Tetrahedron(hex.vertices[0], hex.vertices[7], hex.vertices[1],
-                        hex.vertices[2]);
+  [[nodiscard]] auto face_area(const std::size_t face_idx) const -> Scalar {
+    const auto& mapping = Element::face_vertex_mapping[face_idx];
+    const auto& v0 = vertices[mapping[0]];
 
-  tets[5] = Tetrahedron(hex.vertices[1], hex.vertices[7], hex.vertices[6],
-                        hex.vertices[2]);
-}
+    auto area = Scalar{0};
+    for (auto idx = 2u; idx < Element::face_vertex_count[face_idx]; ++idx) {
+      area += ((vertices[mapping[idx - 1]] - v0)
+                   .cross(vertices[mapping[idx]] - v0))
+                  .stableNorm();
+    }
 
-inline auto contains(const Sphere& s, const Vector& p) -> bool {
-  return (s.center - p).squaredNorm() <= s.radius * s.radius;
-}
+    return Scalar{0.5} * area;
+  }
 
-// The (convex!) polygon is assumed to be planar, making this a 2D problem.
-// Check the projection of the point onto the plane of the polygon for
-// containment within the polygon.
-template<std::size_t VertexCount>
-auto contains(const Polygon<VertexCount>& poly, const Vector& point) -> bool {
-  const Vector proj =
-      point - poly.normal.dot(point - poly.center) * poly.normal;
+  [[nodiscard]] auto surface_area() const -> Scalar {
+    auto area = Scalar{0};
+    for (auto face_idx = 0u; face_idx < face_count; ++face_idx) {
+      area += face_area(face_idx);
+    }
 
-  for (std::size_t n = 0; n < poly.vertices.size(); ++n) {
-    const auto& v0 = poly.vertices[n];
-    const auto& v1 = poly.vertices[(n + 1) % poly.vertices.size()];
+    return area;
+  }
 
-    // Note: Only the sign of the projection is of interest, so this vector
-    // does not have to be normalized.
-    const auto dir = (v1 - v0).cross(poly.normal);
+  std::array<Vector, vertex_count> vertices;
+  std::array<Plane, face_count> faces;
+  Vector center = Vector::Zero();
+  Scalar volume = Scalar{0};
 
-    // Check whether the projection of the point lies inside of the
-    // polygon.
-    if (dir.dot(proj - Scalar{0.5} * (v0 + v1)) > Scalar{0}) {
-      return false;
+ private:
+  // plane of the face, computed as for the polygons of the full element
+  template<std::size_t FaceVertexCount>
+  [[nodiscard]] auto face_plane(const std::size_t face_idx) const -> Plane {
+    const auto& mapping = Element::face_vertex_mapping[face_idx];
+
+    auto face_vertices = std::array<Vector, FaceVertexCount>{};
+    for (auto idx = 0u; idx < FaceVertexCount; ++idx) {
+      face_vertices[idx] = vertices[mapping[idx]];
     }
+
+    const auto face_center = polygon_center(face_vertices);
+    return Plane{face_center, polygon_normal(face_vertices, face_center)};
   }
+};
 
-  return true;
-}
+using CompactTetrahedron = CompactElement<Tetrahedron>;
+using CompactWedge = CompactElement<Wedge>;
+using CompactHexahedron = CompactElement<Hexahedron>;
+using CompactPyramid = CompactElement<Pyramid>;
 
-template<typename Element, typename = std::enable_if_t<is_element_v<Element>>>
-inline auto contains(const Element& element, const Vector& p) -> bool {
-  return std::all_of(std::begin(element.faces), std::end(element.faces),
-                     [&](const auto& face) -> bool {
-                       return face.normal.dot(p - face.center) <= Scalar{0};
-                     });
-}
+// Lightweight view of an element of an indexed mesh, referencing the vertices
+// in the shared vertex pool of the mesh via the connectivity of the element.
+// A standalone element is only created on demand.
+template<typename Element, typename Index = std::uint32_t>
+class ElementView {
+  static_assert(is_element_v<Element>, "invalid element type detected");
 
-template<typename Element, typename = std::enable_if_t<is_element_v<Element>>>
-inline auto contains(const Sphere& sphere, const Element& element) -> bool {
-  return std::all_of(std::begin(element.vertices), std::end(element.vertices),
-                     [&](const Vector& vertex) {
-                       return (sphere.center - vertex).squaredNorm() <=
-                              sphere.radius * sphere.radius;
-                     });
-}
+ public:
+  static constexpr auto vertex_count = num_vertices<Element>();
 
-inline auto intersects(const Sphere& s, const Plane& p) -> bool {
-  const auto proj = p.normal.dot(s.center - p.center);
+  ElementView(const Vector* vertices, const Index* indices) :
+      vertices_{vertices}, indices_{indices} {}
 
-  return proj * proj - s.radius * s.radius < Scalar{0};
-}
+  [[nodiscard]] auto vertex(const std::size_t idx) const -> const Vector& {
+    return vertices_[indices_[idx]];
+  }
 
-template<std::size_t VertexCount>
-inline auto intersects(const Sphere& s, const Polygon<VertexCount>& poly)
-    -> bool {
-  return intersects(s, {poly.center, poly.normal}) && contains(poly, s.center);
-}
+  [[nodiscard]] auto element() const -> Element {
+    return Element{gather_vertices()};
+  }
 
-template<typename Element, typename = std::enable_if_t<is_element_v<Element>>>
-inline auto intersects_coarse(const Sphere& sphere, const Element& element)
-    -> bool {
-  using AABB = Eigen::AlignedBox<Scalar, 3>;
+  // The compact representation suffices for the overlap calculation and is
+  // cheaper to set up than the full element, see CompactElement.
+  [[nodiscard]] auto compact() const -> CompactElement<Element> {
+    return CompactElement<Element>{gather_vertices()};
+  }
 
-  const auto sphere_aabb =
-      AABB{sphere.center - Vector::Constant(sphere.radius),
-           sphere.center + Vector::Constant(sphere.radius)};
+ private:
+  [[nodiscard]] auto gather_vertices() const
+      -> std::array<Vector, vertex_count> {
+    auto verts = std::array<Vector, vertex_count>{};
+    for (auto idx = 0u; idx < vertex_count; ++idx) {
+      verts[idx] = vertex(idx);
+    }
 
-  auto element_aabb = AABB{};
-  for (const auto& v : element.vertices) {
-    element_aabb.extend(v);
+    return verts;
   }
 
-  return sphere_aabb.intersects(element_aabb);
-}
+  const Vector* vertices_;
+  const Index* indices_;
+};
 
-inline auto line_sphere_intersection(const Vector& base,
-                                     const Vector& direction,
-                                     const Sphere& sphere)
-    -> std::array<std::optional<Scalar>, 2> {
-  const auto a = direction.squaredNorm();
-  if (a == Scalar{0}) {
-    return std::array<std::optional<Scalar>, 2>{};
-  }
+// Mesh consisting of elements of a single type, storing each vertex only once
+// in a shared pool. The connectivity holds the (zero-based) indices of the
+// vertices of all elements consecutively, each element following the node
+// ordering of CGNS.
+template<typename Element, typename Index = std::uint32_t>
+class IndexedMesh {
+  static_assert(is_element_v<Element>, "invalid element type detected");
+  static_assert(std::is_unsigned_v<Index>, "invalid index type detected");
 
-  const auto origin_relative = (base - sphere.center).eval();
-  const auto b = Scalar{2} * direction.dot(origin_relative);
-  const auto c = origin_relative.squaredNorm() - sphere.radius * sphere.radius;
+ public:
+  using View = ElementView<Element, Index>;
 
-  const auto discriminant = b * b - Scalar{4} * a * c;
-  if (discriminant > Scalar{0}) {
-    // two real roots
-    const auto q =
-        Scalar{-0.5} * (b + std::copysign(std::sqrt(discriminant), b));
+  static constexpr auto vertex_count = num_vertices<Element>();
 
-    auto x1 = q / a;
-    auto x2 = c / q;
+  IndexedMesh() = default;
 
-    if (x1 > x2) {
-      std::swap(x1, x2);
+  IndexedMesh(std::vector<Vector> vertices, std::vector<Index> connectivity) :
+      vertices_{std::move(vertices)}, connectivity_{std::move(connectivity)} {
+    if (connectivity_.size() % vertex_count != 0) {
+      throw std::invalid_argument{"incomplete element in mesh connectivity"};
     }
 
-    // if the midpoint of the two intersection points is not inside the sphere,
-    // the intersection is spurious
-    if (((base + (Scalar{0.5} * (x1 + x2)) * direction) - sphere.center)
-            .squaredNorm() >= sphere.radius * sphere.radius) {
-      return std::array<std::optional<Scalar>, 2>{};
+    if (std::any_of(std::begin(connectivity_), std::end(connectivity_),
+                    [&](const Index idx) { return idx >= vertices_.size(); })) {
+      throw std::invalid_argument{"invalid vertex index in mesh connectivity"};
     }
-
-    return std::array{std::make_optional(x1), std::make_optional(x2)};
   }
 
-  if (std::abs(discriminant) == Scalar{0}) {
-    // double real root, line tangential to the sphere's surface
-    return std::array{std::make_optional((Scalar{-0.5} * b) / a),
-                      std::optional<Scalar>{}};
+  [[nodiscard]] auto size() const -> std::size_t {
+    return connectivity_.size() / vertex_count;
   }
 
-  // no real roots
-  return std::array<std::optional<Scalar>, 2>{};
-}
-
-// Calculate the volume of a regularized spherical wedge defined by the
-// radius, the distance of the intersection point from the center of the
-// sphere and the angle.
-inline auto regularized_wedge(Scalar r, Scalar d, Scalar alpha) -> Scalar {
-#ifndef NDEBUG
-  // clamp slight deviations of the angle to valid range
-  if (alpha < Scalar{0} && alpha > -detail::tiny_epsilon) {
-    alpha = Scalar{0};
+  [[nodiscard]] auto operator[](const std::size_t element_idx) const -> View {
+    return View{vertices_.data(),
+                connectivity_.data() + (element_idx * vertex_count)};
   }
 
-  if (alpha > Scalar{0.5} * pi && alpha <= Scalar{0.5} * pi + tiny_epsilon) {
-    alpha = Scalar{0.5} * pi;
+  [[nodiscard]] auto vertices() const -> const std::vector<Vector>& {
+    return vertices_;
   }
-#endif
 
-  overlap_assert(r > Scalar{0}, "invalid argument 'r' for regularized_wedge()");
+  [[nodiscard]] auto connectivity() const -> const std::vector<Index>& {
+    return connectivity_;
+  }
 
-  overlap_assert(d >= Scalar{0} && d <= r,
-                 "invalid argument 'd' for regularized_wedge()");
+ private:
+  std::vector<Vector> vertices_;
+  std::vector<Index> connectivity_;
+};
 
-  overlap_assert(alpha >= Scalar{0} && alpha <= Scalar{0.5} * pi,
-                 "invalid argument 'alpha' for regularized_wedge()");
+// Mesh consisting of elements of different types. The elements of each type
+// are stored contiguously in a separate batch, together with their indices in
+// the order of insertion. This allows processing the elements type by type
+// instead of dispatching on the type of every single element.
+template<typename... Elements>
+class HybridMesh {
+  static_assert((is_element_v<Elements> && ...),
+                "invalid element type detected");
 
-  const auto sin_alpha = std::sin(alpha);
-  const auto cos_alpha = std::cos(alpha);
+ public:
+  template<typename Element>
+  struct Batch {
+    std::vector<Element> elements;
+    std::vector<std::size_t> indices;
+  };
 
-  const auto a = d * sin_alpha;
-  const auto b = std::sqrt(std::abs(r * r - d * d));
-  const auto c = d * cos_alpha;
+  // Append an element and return its index within the mesh.
+  template<typename Element>
+  auto push_back(Element element) -> std::size_t {
+    static_assert((std::is_same_v<Element, Elements> || ...),
+                  "element type not supported by mesh");
 
-  return (Scalar{1} / Scalar{3}) * a * b * c +
-         a * ((Scalar{1} / Scalar{3}) * a * a - r * r) * std::atan2(b, c) +
-         (Scalar{2} / Scalar{3}) * r * r * r *
-             std::atan2(sin_alpha * b, cos_alpha * r);
-}
+    auto& batch = std::get<Batch<Element>>(batches_);
+    batch.elements.push_back(std::move(element));
+    batch.indices.push_back(size_);
 
-// Wrapper around the above function handling correctly handling the case of
-// alpha > pi/2 and negative z.
-inline auto regularized_wedge(Scalar r, Scalar d, Scalar alpha, Scalar z)
-    -> Scalar {
-  if (z >= Scalar{0}) {
-    if (alpha > Scalar{0.5} * pi) {
-      const auto h = r - z;
+    return size_++;
+  }
 
-      return (pi / Scalar{3}) * h * h * (Scalar{3} * r - h) -
-             regularized_wedge(r, d, pi - alpha);
-    }
+  [[nodiscard]] auto size() const -> std::size_t { return size_; }
 
-    return regularized_wedge(r, d, alpha);
+  template<typename Element>
+  [[nodiscard]] auto batch() const -> const Batch<Element>& {
+    return std::get<Batch<Element>>(batches_);
   }
 
-  const auto hemisphere_volume = ((Scalar{2} / Scalar{3}) * pi) * r * r * r;
-  if (alpha > Scalar{0.5} * pi) {
-    return hemisphere_volume - regularized_wedge(r, d, pi - alpha);
+  // Call the function for the batches of all element types.
+  template<typename F>
+  void for_each_batch(F&& f) const {
+    (f(std::get<Batch<Elements>>(batches_)), ...);
   }
 
-  const auto h = r + z;
-  const auto cap_volume = (pi / Scalar{3}) * h * h * (Scalar{3} * r - h);
+ private:
+  std::tuple<Batch<Elements>...> batches_;
+  std::size_t size_ = 0;
+};
 
-  return hemisphere_volume - (cap_volume - regularized_wedge(r, d, alpha));
-}
+// Element scaled once by the inverse of a fixed sphere radius, intended for
+// systems of spheres of identical radius. Normalizing the element w.r.t. a
+// sphere of this radius then only requires a translation, leaving the face
+// areas, normals and the volume of the element unchanged.
+template<typename Element>
+class PrescaledElement {
+  static_assert(is_element_v<Element>, "invalid element type detected");
 
-// Calculate the surface area of a regularized spherical wedge defined by the
-// radius, the distance of the intersection point from the center of the
-// sphere and the angle.
-// Ref: Gibson, K. D. & Scheraga, H. A.: Exact calculation of the volume and
-//    surface area of fused hard-sphere molecules with unequal atomic radii,
-//    Molecular Physics, 1987, 62, 1247-1265
-inline auto regularized_wedge_area(Scalar r, Scalar z, Scalar alpha) -> Scalar {
-#ifndef NDEBUG
-  // clamp slight deviations of the angle to valid range
-  if (alpha < Scalar{0} && alpha > -tiny_epsilon) {
-    alpha = Scalar{0};
-  }
+ public:
+  PrescaledElement(const Element& element, const Scalar radius) :
+      scaled_{element}, radius_{radius}, volume_{element.volume} {
+    overlap_assert(radius > Scalar{0}, "invalid radius for prescaling");
 
-  if (alpha > pi && alpha <= pi + tiny_epsilon) {
-    alpha = pi;
+    // the faces are checked once instead of for every sphere
+    detect_non_planar_faces(element);
+
+    scaled_.apply(Transformation{Vector::Zero(), Scalar{1} / radius});
   }
-#endif
 
-  overlap_assert(r > Scalar{0},
-                 "invalid argument 'r' for regularized_wedge_area()");
+  [[nodiscard]] auto radius() const -> Scalar { return radius_; }
 
-  overlap_assert(z >= -r && z <= r,
-                 "invalid argument 'z' for regularized_wedge_area()");
+  // volume of the original, unscaled element
+  [[nodiscard]] auto volume() const -> Scalar { return volume_; }
 
-  overlap_assert(alpha >= Scalar{0} && alpha <= pi,
-                 "invalid argument 'alpha' for regularized_wedge_area()");
+  [[nodiscard]] auto scaled() const -> const Element& { return scaled_; }
 
-  if (alpha < tiny_epsilon || std::abs(r * r - z * z) <= tiny_epsilon) {
-    return Scalar{0};
-  }
+ private:
+  Element scaled_;
+  Scalar radius_;
+  Scalar volume_;
+};
 
-  const auto sin_alpha = std::sin(alpha);
-  const auto cos_alpha = std::cos(alpha);
-  const auto factor = Scalar{1} / std::sqrt(std::abs(r * r - z * z));
+// Adaptively refined octree of axis-aligned cells, e.g., the grid of an AMR
+// code. Refining a leaf appends its eight children consecutively, ordered by
+// the x, y and z halves of the parent (x varying fastest). The root is cell 0.
+class Octree {
+ public:
+  using AABB = Eigen::AlignedBox<Scalar, 3>;
 
-  // clamp slight deviations of the argument to acos() to valid range
-  const auto arg0 =
-      clamp(r * cos_alpha * factor, Scalar{-1}, Scalar{1}, tiny_epsilon);
+  struct Node {
+    AABB box;
+    std::size_t level = 0;
+    std::size_t first_child = 0;  // zero for leaves
+  };
 
-  const auto arg1 = clamp((z * cos_alpha * factor) / sin_alpha, Scalar{-1},
-                          Scalar{1}, tiny_epsilon);
-
-  overlap_assert(Scalar{-1} <= arg0 && arg0 <= Scalar{1},
-                 "invalid value for arg0 in regularized_wedge_area()");
-
-  overlap_assert(Scalar{-1} <= arg1 && arg1 <= Scalar{1},
-                 "invalid value for arg1 in regularized_wedge_area()");
+  Octree(const Vector& min, const Vector& max) {
+    if (!(min.array() < max.array()).all()) {
+      throw std::invalid_argument{"invalid bounding box of octree"};
+    }
 
-  return Scalar{2} * r * (r * std::acos(arg0) - z * std::acos(arg1));
-}
+    nodes_.push_back(Node{AABB{min, max}});
+  }
 
-// calculate the volume of the spherical wedge or the area of the spherical
-// lune, depending on the dimensionality
-template<std::size_t Dim>
-inline auto spherical_wedge(const Sphere& s, const Scalar angle) -> Scalar {
-  static_assert(Dim == 2 || Dim == 3, "invalid dimensionality, must be 2 or 3");
+  // Split a leaf into eight children and return the index of the first one.
+  auto refine(const std::size_t node_idx) -> std::size_t {
+    if (node_idx >= nodes_.size() || !is_leaf(node_idx)) {
+      throw std::invalid_argument{"only leaves of an octree can be refined"};
+    }
 
-  if constexpr (Dim == 2) {
-    return Scalar{2} * s.radius * s.radius * angle;
-  }
+    const auto first_child = nodes_.size();
+    const auto parent = nodes_[node_idx];
+    const auto half = Vector{Scalar{0.5} * parent.box.sizes()};
 
-  return (Scalar{2} / Scalar{3}) * s.radius * s.radius * s.radius * angle;
-}
+    for (auto child = 0u; child < 8u; ++child) {
+      const auto offset =
+          Vector{Scalar(child & 1U), Scalar((child >> 1U) & 1U),
+                 Scalar((child >> 2U) & 1U)};
+      const auto min = Vector{parent.box.min() + offset.cwiseProduct(half)};
 
-// Depending on the dimensionality, either the volume or external surface area
-// of the general wedge is computed.
-template<std::size_t Dim>
-inline auto general_wedge(const Sphere& s, const Plane& p0, const Plane& p1,
-                          const Vector& d) -> Scalar {
-  static_assert(Dim == 2 || Dim == 3, "invalid dimensionality, must be 2 or 3");
+      nodes_.push_back(
+          Node{AABB{min, Vector{min + half}}, parent.level + 1, 0});
+    }
 
-  const auto dist = d.stableNorm();
-  if (dist < tiny_epsilon) {
-    // the wedge (almost) touches the center, the volume/area depends only on
-    // the angle
-    return spherical_wedge<Dim>(s, pi - angle(p0.normal, p1.normal));
-  }
+    nodes_[node_idx].first_child = first_child;
+    depth_ = std::max(depth_, parent.level + 2);
+    leaf_count_ += 7;
 
-  if (dist >= s.radius) {
-    // intersection of the two planes (numerically) on the surface of the
-    // sphere
-    return Scalar{0};
+    return first_child;
   }
 
-  const auto s0 = d.dot(p0.normal);
-  const auto s1 = d.dot(p1.normal);
+  [[nodiscard]] auto size() const -> std::size_t { return nodes_.size(); }
 
-  // detect degenerated general spherical wedge that can be treated as
-  // a regularized spherical wedge
-  if (std::abs(s0) < tiny_epsilon || std::abs(s1) < tiny_epsilon) {
-    const auto alpha = pi - angle(p0.normal, p1.normal);
+  // number of levels, the root being on level zero
+  [[nodiscard]] auto depth() const -> std::size_t { return depth_; }
 
-    if constexpr (Dim == 2) {
-      return regularized_wedge_area(
-          s.radius, std::abs(s0) > std::abs(s1) ? s0 : s1, alpha);
-    }
+  [[nodiscard]] auto leaf_count() const -> std::size_t { return leaf_count_; }
 
-    return regularized_wedge(s.radius, dist, alpha,
-                             std::abs(s0) > std::abs(s1) ? s0 : s1);
+  [[nodiscard]] auto node(const std::size_t node_idx) const -> const Node& {
+    return nodes_[node_idx];
   }
 
-  auto d_unit = Vector{d * (Scalar{1} / dist)};
-  if (dist < large_epsilon) {
-    d_unit =
-        gram_schmidt(p0.normal.cross(p1.normal).stableNormalized(), d_unit)[1];
+  [[nodiscard]] auto is_leaf(const std::size_t node_idx) const -> bool {
+    return nodes_[node_idx].first_child == 0;
   }
 
-  overlap_assert(p0.normal.dot(p1.center - p0.center) <= Scalar{0},
-                 "invalid plane in general_wedge()");
+  // hexahedron of a cell following the node ordering of CGNS
+  [[nodiscard]] auto cell(const std::size_t node_idx) const -> Hexahedron {
+    const auto& box = nodes_[node_idx].box;
+    const auto& a = box.min();
+    const auto& b = box.max();
 
-  overlap_assert(p1.normal.dot(p0.center - p1.center) <= Scalar{0},
-                 "invalid plane in general_wedge()");
+    return Hexahedron{Vector{a[0], a[1], a[2]}, Vector{b[0], a[1], a[2]},
+                      Vector{b[0], b[1], a[2]}, Vector{a[0], b[1], a[2]},
+                      Vector{a[0], a[1], b[2]}, Vector{b[0], a[1], b[2]},
+                      Vector{b[0], b[1], b[2]}, Vector{a[0], b[1], b[2]}};
+  }
 
-  // calculate the angles between the vector from the sphere center
-  // to the intersection line and the normal vectors of the two planes
-  auto alpha0 = angle(p0.normal, d_unit);
-  auto alpha1 = angle(p1.normal, d_unit);
+ private:
+  std::vector<Node> nodes_;
+  std::size_t depth_ = 1;
+  std::size_t leaf_count_ = 1;
+};
 
-  const auto pi_half = Scalar{0.5} * pi;
-  const auto dir0 = d_unit.dot((s.center + d) - p0.center);
-  const auto dir1 = d_unit.dot((s.center + d) - p1.center);
+// Sequence container storing up to N elements inline, only switching to
+// dynamically allocated storage if more elements are added.
+template<typename T, std::size_t N>
+class SmallVector {
+ public:
+  SmallVector() = default;
 
-  if (s0 >= Scalar{0} && s1 >= Scalar{0}) {
-    alpha0 = pi_half - std::copysign(alpha0, dir0);
-    alpha1 = pi_half - std::copysign(alpha1, dir1);
+  explicit SmallVector(const std::size_t count, const T& value = T{}) {
+    resize(count, value);
+  }
 
-    if constexpr (Dim == 2) {
-      return regularized_wedge_area(s.radius, s0, alpha0) +
-             regularized_wedge_area(s.radius, s1, alpha1);
-    }
+  [[nodiscard]] auto size() const -> std::size_t { return size_; }
+  [[nodiscard]] auto empty() const -> bool { return size_ == 0; }
 
-    return regularized_wedge(s.radius, dist, alpha0, s0) +
-           regularized_wedge(s.radius, dist, alpha1, s1);
+  // Note: Inline storage is used as long as no heap storage was allocated.
+  [[nodiscard]] auto data() -> T* {
+    return heap_.empty() ? inline_.data() : heap_.data();
   }
 
-  if (s0 < Scalar{0} && s1 < Scalar{0}) {
-    alpha0 = pi_half + std::copysign(Scalar{1}, dir0) * (alpha0 - pi);
-    alpha1 = pi_half + std::copysign(Scalar{1}, dir1) * (alpha1 - pi);
+  [[nodiscard]] auto data() const -> const T* {
+    return heap_.empty() ? inline_.data() : heap_.data();
+  }
 
-    if constexpr (Dim == 2) {
-      return s.surface_area() - (regularized_wedge_area(s.radius, -s0, alpha0) +
-                                 regularized_wedge_area(s.radius, -s1, alpha1));
-    }
+  [[nodiscard]] auto begin() -> T* { return data(); }
+  [[nodiscard]] auto end() -> T* { return data() + size_; }
+  [[nodiscard]] auto begin() const -> const T* { return data(); }
+  [[nodiscard]] auto end() const -> const T* { return data() + size_; }
 
-    return s.volume - (regularized_wedge(s.radius, dist, alpha0, -s0) +
-                       regularized_wedge(s.radius, dist, alpha1, -s1));
+  [[nodiscard]] auto operator[](const std::size_t idx) -> T& {
+    return data()[idx];
   }
 
-  alpha0 = pi_half - std::copysign(Scalar{1}, dir0 * s0) *
-                         (alpha0 - (s0 < Scalar{0} ? pi : Scalar{0}));
+  [[nodiscard]] auto operator[](const std::size_t idx) const -> const T& {
+    return data()[idx];
+  }
 
-  alpha1 = pi_half - std::copysign(Scalar{1}, dir1 * s1) *
-                         (alpha1 - (s1 < Scalar{0} ? pi : Scalar{0}));
+  [[nodiscard]] auto back() -> T& { return data()[size_ - 1]; }
 
-  if constexpr (Dim == 2) {
-    const auto area0 = regularized_wedge_area(s.radius, std::abs(s0), alpha0);
-    const auto area1 = regularized_wedge_area(s.radius, std::abs(s1), alpha1);
+  void push_back(T value) {
+    if (heap_.empty() && size_ < N) {
+      inline_[size_++] = std::move(value);
+      return;
+    }
 
-    return std::max(area0, area1) - std::min(area0, area1);
+    if (heap_.empty()) {
+      heap_.reserve(2 * N);
+      std::move(inline_.begin(), inline_.end(), std::back_inserter(heap_));
+    }
+
+    heap_.push_back(std::move(value));
+    ++size_;
   }
 
-  const auto volume0 = regularized_wedge(s.radius, dist, alpha0, std::abs(s0));
-  const auto volume1 = regularized_wedge(s.radius, dist, alpha1, std::abs(s1));
+  void resize(const std::size_t count, const T& value = T{}) {
+    while (size_ < count) {
+      push_back(value);
+    }
 
-  return std::max(volume0, volume1) - std::min(volume0, volume1);
-}
+    if (!heap_.empty()) {
+      heap_.resize(count);
+    }
 
-template<typename Element>
-using EdgeIntersections =
-    std::array<std::optional<std::array<Vector, 2>>, num_edges<Element>()>;
+    size_ = count;
+  }
 
-// Depending on the dimensionality, either the volume or external surface area
-// of the general wedge is computed.
-template<std::size_t Dim, typename Element>
-auto general_wedge(const Sphere& sphere, const Element& element,
-                   std::size_t edge,
-                   const EdgeIntersections<Element>& intersections) {
-  static_assert(Dim == 2 || Dim == 3, "invalid dimensionality, must be 2 or 3");
+  void clear() {
+    heap_.clear();
+    size_ = 0;
+  }
 
-  const auto& f0 = element.faces[Element::edge_mapping[edge][1][0]];
-  const auto& f1 = element.faces[Element::edge_mapping[edge][1][1]];
+ private:
+  std::array<T, N> inline_ = {};
+  std::vector<T> heap_;
+  std::size_t size_ = 0;
+};
 
-  overlap_assert(intersections[edge].has_value(),
-                 "inconsistent intersection detection for edge");
+// Convex polyhedron with an arbitrary number of vertices and faces. The faces
+// are given as lists of indices of their vertices, ordered counterclockwise
+// when viewed from the outside. The edges and their adjacent faces are derived
+// from this face list. Typical cells of polyhedral meshes are stored without
+// allocating memory.
+class ConvexPolyhedron {
+ public:
+  static constexpr std::size_t inline_vertices = 32;
+  static constexpr std::size_t inline_faces = 20;
+  static constexpr std::size_t inline_edges = 48;
+
+  // Edge defined by its two vertices and the two faces joining at the edge.
+  struct Edge {
+    std::array<uint32_t, 2> vertices;
+    std::array<uint32_t, 2> faces;
+  };
 
-  const auto edge_midpoint = Vector{
-      Scalar{0.5} * (((*intersections[edge])[0] +
-                      element.vertices[Element::edge_mapping[edge][0][0]]) +
-                     ((*intersections[edge])[1] +
-                      element.vertices[Element::edge_mapping[edge][0][1]]))};
+  ConvexPolyhedron() = default;
 
-  const auto p0 = Plane{f0.center, f0.normal};
-  const auto p1 = Plane{f1.center, f1.normal};
+  template<typename VertexRange, typename FaceRange>
+  ConvexPolyhedron(const VertexRange& verts, const FaceRange& face_list) {
+    for (const auto& v : verts) {
+      vertices.push_back(v);
+    }
 
-  return general_wedge<Dim>(sphere, p0, p1, edge_midpoint - sphere.center);
-}
+    face_offsets.push_back(0);
+    for (const auto& face : face_list) {
+      if (std::size(face) < 3) {
+        throw std::invalid_argument{"degenerate face in polyhedron"};
+      }
 
-// if not all three edges intersecting at a vertex are marked, the
-// sphere is only touching this vertex
-template<typename Element, typename = std::enable_if_t<is_element_v<Element>>>
-inline auto correct_marked_vertices(
-    const std::bitset<num_vertices<Element>()>& marked_vertices,
-    const std::bitset<num_edges<Element>()>& marked_edges)
-    -> std::bitset<num_vertices<Element>()> {
-  auto corrected_marked_vertices = marked_vertices;
+      for (const auto vertex_idx : face) {
+        if (static_cast<std::size_t>(vertex_idx) >= vertices.size()) {
+          throw std::invalid_argument{"invalid vertex index in polyhedron"};
+        }
 
-  for (auto vertex_idx = 0u; vertex_idx < marked_vertices.size();
-       ++vertex_idx) {
-    if (!marked_vertices[vertex_idx]) {
-      continue;
-    }
+        face_vertices.push_back(static_cast<uint32_t>(vertex_idx));
+      }
 
-    auto all_edges_marked = true;
-    for (auto local_edge_idx = 0u; local_edge_idx < 3u; ++local_edge_idx) {
-      const auto edge_idx =
-          Element::vertex_mapping[vertex_idx][0][local_edge_idx];
-      all_edges_marked &= static_cast<bool>(marked_edges[edge_idx]);
+      face_offsets.push_back(static_cast<uint32_t>(face_vertices.size()));
     }
 
-    corrected_marked_vertices[vertex_idx] = all_edges_marked;
+    init_edges();
+    init();
   }
 
-  return corrected_marked_vertices;
-}
+  void apply(const Transformation& t) {
+    for (auto& v : vertices) {
+      v = t.scaling * (v + t.translation);
+    }
 
-template<typename Element>
-struct EntityIntersections {
-  std::bitset<num_vertices<Element>()> vertices;
-  std::bitset<num_edges<Element>()> edges;
-  std::bitset<num_faces<Element>()> faces;
-};
+    for (auto& f : faces) {
+      f.center = t.scaling * (f.center + t.translation);
+      f.area *= t.scaling * t.scaling;
+    }
 
-template<typename Element>
-auto unit_sphere_intersections(const Element& element)
-    -> std::tuple<EntityIntersections<Element>, EdgeIntersections<Element>> {
-  const auto unit_sphere = Sphere{};
+    center = t.scaling * (center + t.translation);
+    volume *= t.scaling * t.scaling * t.scaling;
+  }
 
-  auto entity_intersections = EntityIntersections<Element>{};
+  [[nodiscard]] auto num_vertices() const -> std::size_t {
+    return vertices.size();
+  }
 
-  // the intersection points between the single edges and the sphere are cached
-  auto edge_intersections = EdgeIntersections<Element>{};
+  [[nodiscard]] auto num_faces() const -> std::size_t { return faces.size(); }
+  [[nodiscard]] auto num_edges() const -> std::size_t { return edges.size(); }
 
-  for (auto edge_idx = 0u; edge_idx < num_edges<Element>(); ++edge_idx) {
-    const auto base = element.vertices[Element::edge_mapping[edge_idx][0][0]];
-    const auto direction =
-        (element.vertices[Element::edge_mapping[edge_idx][0][1]] - base).eval();
+  [[nodiscard]] auto face_vertex_count(const std::size_t face_idx) const
+      -> std::size_t {
+    return face_offsets[face_idx + 1] - face_offsets[face_idx];
+  }
 
-    const auto&& intersections =
-        line_sphere_intersection(base, direction, unit_sphere);
+  [[nodiscard]] auto face_vertex(const std::size_t face_idx,
+                                 const std::size_t idx) const -> const Vector& {
+    return vertices[face_vertices[face_offsets[face_idx] + idx]];
+  }
 
-    // no intersection between the edge and the sphere, where touching
-    // (tangential) contacts are ignored
-    if (!intersections[1].has_value() || *intersections[0] >= Scalar{1} ||
-        *intersections[1] <= Scalar{0}) {
-      continue;
+  [[nodiscard]] auto is_face_planar(const std::size_t face_idx) const -> bool {
+    const auto& face = faces[face_idx];
+    for (auto idx = 0u; idx < face_vertex_count(face_idx); ++idx) {
+      if (std::abs(face.normal.dot(face_vertex(face_idx, idx) - face.center)) >
+          large_epsilon) {
+        return false;
+      }
     }
 
-    entity_intersections.vertices[Element::edge_mapping[edge_idx][0][0]] =
-        entity_intersections.vertices[Element::edge_mapping[edge_idx][0][0]] ||
-        *intersections[0] < Scalar{0};
+    return true;
+  }
 
-    entity_intersections.vertices[Element::edge_mapping[edge_idx][0][1]] =
-        entity_intersections.vertices[Element::edge_mapping[edge_idx][0][1]] ||
-        *intersections[1] > Scalar{1};
+  [[nodiscard]] auto surface_area() const -> Scalar {
+    return std::accumulate(
+        std::begin(faces), std::end(faces), Scalar{0},
+        [](auto sum, const auto& face) { return sum + face.area; });
+  }
 
-    // note: the intersection points are relative to the vertices
-    edge_intersections[edge_idx] =
-        std::array<Vector, 2>{*intersections[0] * direction,
-                              (*intersections[1] - Scalar{1}) * direction};
+ private:
+  // Each edge is shared by exactly two faces, traversing it in opposite
+  // directions.
+  void init_edges() {
+    for (auto face_idx = 0u; face_idx + 1 < face_offsets.size(); ++face_idx) {
+      const auto count = face_vertex_count(face_idx);
+      for (auto idx = 0u; idx < count; ++idx) {
+        const auto v0 = face_vertices[face_offsets[face_idx] + idx];
+        const auto v1 =
+            face_vertices[face_offsets[face_idx] + ((idx + 1) % count)];
+
+        auto edge = std::find_if(
+            std::begin(edges), std::end(edges), [&](const Edge& e) {
+              return e.vertices[0] == v1 && e.vertices[1] == v0;
+            });
 
-    entity_intersections.edges[edge_idx] = true;
+        if (edge == std::end(edges)) {
+          edges.push_back(Edge{{v0, v1}, {face_idx, face_idx}});
+          continue;
+        }
 
-    // if the edge is marked as having an overlap, the two faces forming it
-    // have to be marked as well
-    entity_intersections.faces[Element::edge_mapping[edge_idx][1][0]] = true;
-    entity_intersections.faces[Element::edge_mapping[edge_idx][1][1]] = true;
-  }
+        if (edge->faces[0] != edge->faces[1]) {
+          throw std::invalid_argument{"non-manifold edge in polyhedron"};
+        }
 
-  // check whether the dependencies for a vertex intersection are fulfilled
-  entity_intersections.vertices = correct_marked_vertices<Element>(
-      entity_intersections.vertices, entity_intersections.edges);
+        edge->faces[1] = face_idx;
+      }
+    }
 
-  // check the interior of all faces for intersection with the unit sphere
-  for (auto face_idx = 0u; face_idx < num_faces<Element>(); ++face_idx) {
-    if (intersects(unit_sphere, element.faces[face_idx])) {
-      entity_intersections.faces[face_idx] = true;
+    if (std::any_of(std::begin(edges), std::end(edges), [](const Edge& e) {
+          return e.faces[0] == e.faces[1];
+        })) {
+      throw std::invalid_argument{"polyhedron is not closed"};
     }
   }
 
-  return std::make_tuple(entity_intersections, edge_intersections);
-}
+  void init() {
+    center = (Scalar{1} / static_cast<Scalar>(vertices.size())) *
+             std::accumulate(std::begin(vertices), std::end(vertices),
+                             Vector::Zero().eval());
 
-template<std::size_t Dim, typename Element>
-auto vertex_cone_correction(
-    const Element& element,
-    const EdgeIntersections<Element>& edge_intersections,
-    const std::size_t vertex_idx) -> Scalar {
-  static_assert(Dim == 2 || Dim == 3,
-                "invalid dimension for computation of correction at vertex");
+    // Newell's method provides both the normal and the area of the faces.
+    faces.resize(face_offsets.size() - 1);
+    volume = Scalar{0};
+    for (auto face_idx = 0u; face_idx < faces.size(); ++face_idx) {
+      const auto count = face_vertex_count(face_idx);
 
-  // Collect the points where the three edges intersecting at this
-  // vertex intersect the sphere.
-  // Both the relative and the absolute positions are required.
-  auto relative_intersection_points = std::array<Vector, 3>{};
-  auto intersection_points = std::array<Vector, 3>{};
-  for (auto local_edge_idx = 0u; local_edge_idx < 3; ++local_edge_idx) {
-    const auto edge_idx =
-        Element::vertex_mapping[vertex_idx][0][local_edge_idx];
+      auto& face = faces[face_idx];
+      face.center = Vector::Zero();
+      for (auto idx = 0u; idx < count; ++idx) {
+        face.center += face_vertex(face_idx, idx);
+      }
 
-    overlap_assert(edge_intersections[edge_idx].has_value(),
-                   "inconsistent intersection detection for edge");
+      face.center /= static_cast<Scalar>(count);
 
-    relative_intersection_points[local_edge_idx] =
-        (*edge_intersections[edge_idx])
-            [Element::vertex_mapping[vertex_idx][1][local_edge_idx]];
+      auto normal = Vector::Zero().eval();
+      for (auto idx = 0u; idx < count; ++idx) {
+        normal += (face_vertex(face_idx, idx) - face.center)
+                      .cross(face_vertex(face_idx, (idx + 1) % count) -
+                             face.center);
+      }
 
-    intersection_points[local_edge_idx] =
-        relative_intersection_points[local_edge_idx] +
-        element.vertices[vertex_idx];
+      face.area = Scalar{0.5} * normal.stableNorm();
+      face.normal = normal.stableNormalized();
+
+      volume += face.area * face.normal.dot(face.center - center);
+    }
+
+    volume /= Scalar{3};
   }
 
-  // This triangle is constructed by hand to have more freedom of how
-  // the normal vector is calculated.
-  auto cone_triangle = Triangle{};
-  cone_triangle.vertices = {
-      {intersection_points[0], intersection_points[1], intersection_points[2]}};
+ public:
+  SmallVector<Vector, inline_vertices> vertices;
+  SmallVector<uint32_t, inline_faces + 1> face_offsets;
+  SmallVector<uint32_t, 4 * inline_faces> face_vertices;
+  SmallVector<PolygonBase, inline_faces> faces;
+  SmallVector<Edge, inline_edges> edges;
+  Vector center = Vector::Zero();
+  Scalar volume = Scalar{0};
+};
 
-  cone_triangle.center =
-      (Scalar{1} / Scalar{3}) * std::accumulate(intersection_points.begin(),
-                                                intersection_points.end(),
-                                                Vector::Zero().eval());
+// Decomposition of a tetrahedron into 4 tetrahedra.
+inline void decompose(const Tetrahedron& tet,
+                      std::array<Tetrahedron, 4>& tets) {
+  tets[0] = Tetrahedron(tet.vertices[0], tet.vertices[1], tet.vertices[2],
+                        tet.center);
 
-  // Calculate the normal of the triangle defined by the intersection
-  // points in relative coordinates to improve accuracy.
-  // Also use double the normal precision to calculate this normal.
-  cone_triangle.normal = triangle_normal(relative_intersection_points[0],
-                                         relative_intersection_points[1],
-                                         relative_intersection_points[2]);
+  tets[1] = Tetrahedron(tet.vertices[0], tet.vertices[1], tet.center,
+                        tet.vertices[3]);
 
-  // The area of this triangle is never needed, so it is set to an
-  // invalid value.
-  cone_triangle.area = std::numeric_limits<Scalar>::infinity();
+  tets[2] = Tetrahedron(tet.vertices[1], tet.vertices[2], tet.center,
+                        tet.vertices[3]);
+
+  tets[3] = Tetrahedron(tet.vertices[2], tet.vertices[0], tet.center,
+                        tet.vertices[3]);
+}
+
+template<typename Element>
+inline constexpr bool is_pyramid_v = std::is_same_v<Element, Pyramid>;
+
+template<typename Element>
+inline constexpr bool is_pyramid_v<CompactElement<Element>> =
+    is_pyramid_v<Element>;
+
+// Decomposition of a pyramid into 2 tetrahedra.
+template<typename Element, typename = std::enable_if_t<is_pyramid_v<Element>>>
+inline void decompose(const Element& pyramid,
+                      std::array<Tetrahedron, 2>& tets) {
+  tets[0] = Tetrahedron(pyramid.vertices[0], pyramid.vertices[1],
+                        pyramid.vertices[2], pyramid.vertices[4]);
+
+  tets[1] = Tetrahedron(pyramid.vertices[0], pyramid.vertices[2],
+                        pyramid.vertices[3], pyramid.vertices[4]);
+}
+
+// Decomposition of a hexahedron into 2 wedges.
+inline void decompose(const Hexahedron& hex, std::array<Wedge, 2>& wedges) {
+  wedges[0] = Wedge(hex.vertices[0], hex.vertices[1], hex.vertices[2],
+                    hex.vertices[4], hex.vertices[5], hex.vertices[6]);
+
+  wedges[1] = Wedge(hex.vertices[0], hex.vertices[2], hex.vertices[3],
+                    hex.vertices[4], hex.vertices[6], hex.vertices[7]);
+}
+
+// Decomposition of a hexahedron into 5 tetrahedra.
+inline void decompose(const Hexahedron& hex, std::array<Tetrahedron, 5>& tets) {
+  tets[0] = Tetrahedron(hex.vertices[0], hex.vertices[1], hex.vertices[2],
+                        hex.vertices[5]);
+
+  tets[1] = Tetrahedron(hex.vertices[0], hex.vertices[2], hex.vertices[7],
+                        hex.vertices[5]);
+
+  tets[2] = Tetrahedron(hex.vertices[0], hex.vertices[2], hex.vertices[3],
+                        hex.vertices[7]);
+
+  tets[3] = Tetrahedron(hex.vertices[0], hex.vertices[5], hex.vertices[7],
+                        hex.vertices[4]);
+
+  tets[4] = Tetrahedron(hex.vertices[2], hex.vertices[7], hex.vertices[5],
+                        hex.vertices[6]);
+}
+
+// Decomposition of a hexahedron into 6 tetrahedra.
+inline void decompose(const Hexahedron& hex, std::array<Tetrahedron, 6>& tets) {
+  tets[0] = Tetrahedron(hex.vertices[0], hex.vertices[5], hex.vertices[7],
+                        hex.vertices[4]);
+
+  tets[1] = Tetrahedron(hex.vertices[0], hex.vertices[1], hex.vertices[7],
+                        hex.vertices[5]);
+
+  tets[2] = Tetrahedron(hex.vertices[1], hex.vertices[6], hex.vertices[7],
+                        hex.vertices[5]);
+
+  tets[3] = Tetrahedron(hex.vertices[0], hex.vertices[7], hex.vertices[2],
+                        hex.vertices[3]);
+
+  tets[4] = Tetrahedron(hex.vertices[0], hex.vertices[7], hex.vertices[1],
+                        hex.vertices[2]);
+
+  tets[5] = Tetrahedron(hex.vertices[1], hex.vertices[7], hex.vertices[6],
+                        hex.vertices[2]);
+}
+
+inline auto contains(const Sphere& s, const Vector& p) -> bool {
+  return (s.center - p).squaredNorm() <= s.radius * s.radius;
+}
+
+// The (convex!) polygon is assumed to be planar, making this a 2D problem.
+// Check the projection of the point onto the plane of the polygon, given by
+// the center and the normal, for containment within the polygon. The vertices
+// of the polygon are provided via the accessor.
+template<typename VertexAccessor>
+auto contains_projection(const std::size_t vertex_count,
+                         const VertexAccessor& vertex, const Vector& center,
+                         const Vector& normal, const Vector& point) -> bool {
+  const Vector proj = point - normal.dot(point - center) * normal;
+
+  for (std::size_t n = 0; n < vertex_count; ++n) {
+    const auto& v0 = vertex(n);
+    const auto& v1 = vertex((n + 1) % vertex_count);
+
+    // Note: Only the sign of the projection is of interest, so this vector
+    // does not have to be normalized.
+    const auto dir = (v1 - v0).cross(normal);
+
+    // Check whether the projection of the point lies inside of the
+    // polygon.
+    if (dir.dot(proj - Scalar{0.5} * (v0 + v1)) > Scalar{0}) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template<std::size_t VertexCount>
+auto contains(const Polygon<VertexCount>& poly, const Vector& point) -> bool {
+  return contains_projection(
+      VertexCount,
+      [&](const std::size_t idx) -> const Vector& {
+        return poly.vertices[idx];
+      },
+      poly.center, poly.normal, point);
+}
+
+template<typename Element, typename = std::enable_if_t<is_element_v<Element>>>
+inline auto contains(const Element& element, const Vector& p) -> bool {
+  for (auto face_idx = 0u; face_idx < num_faces<Element>(); ++face_idx) {
+    const auto& face = element.faces[face_idx];
+    if (face.normal.dot(p - face.center) > Scalar{0}) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template<typename Element, typename = std::enable_if_t<is_element_v<Element>>>
+inline auto contains(const Sphere& sphere, const Element& element) -> bool {
+  return std::all_of(std::begin(element.vertices), std::end(element.vertices),
+                     [&](const Vector& vertex) {
+                       return (sphere.center - vertex).squaredNorm() <=
+                              sphere.radius * sphere.radius;
+                     });
+}
+
+// The sphere is contained in the (convex) element if it lies on the inner side
+// of the planes of all faces.
+template<typename Element, typename = std::enable_if_t<is_element_v<Element>>>
+inline auto contains(const Element& element, const Sphere& sphere) -> bool {
+  for (auto face_idx = 0u; face_idx < num_faces<Element>(); ++face_idx) {
+    const auto& face = element.faces[face_idx];
+    if (face.normal.dot(sphere.center - face.center) > -sphere.radius) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+inline auto intersects(const Sphere& s, const Plane& p) -> bool {
+  const auto proj = p.normal.dot(s.center - p.center);
+
+  return proj * proj - s.radius * s.radius < Scalar{0};
+}
+
+template<std::size_t VertexCount>
+inline auto intersects(const Sphere& s, const Polygon<VertexCount>& poly)
+    -> bool {
+  return intersects(s, {poly.center, poly.normal}) && contains(poly, s.center);
+}
+
+// Uniform access to the faces of the full and the compact element
+// representations.
+template<typename Element>
+inline auto intersects_face(const Sphere& s, const Element& element,
+                            const std::size_t face_idx) -> bool {
+  return visit(element.faces, face_idx,
+               [&](const auto& face) { return intersects(s, face); });
+}
+
+template<typename Element>
+inline auto intersects_face(const Sphere& s,
+                            const CompactElement<Element>& element,
+                            const std::size_t face_idx) -> bool {
+  const auto& face = element.faces[face_idx];
+  const auto& mapping = Element::face_vertex_mapping[face_idx];
+
+  return intersects(s, face) &&
+         contains_projection(
+             Element::face_vertex_count[face_idx],
+             [&](const std::size_t idx) -> const Vector& {
+               return element.vertices[mapping[idx]];
+             },
+             face.center, face.normal, s.center);
+}
+
+template<typename Element>
+inline auto face_area(const Element& element, const std::size_t face_idx)
+    -> Scalar {
+  return element.faces[face_idx].area;
+}
+
+template<typename Element>
+inline auto face_area(const CompactElement<Element>& element,
+                      const std::size_t face_idx) -> Scalar {
+  return element.face_area(face_idx);
+}
+
+template<typename Element>
+inline auto is_face_planar(const Element& element, const std::size_t face_idx)
+    -> bool {
+  return visit(element.faces, face_idx,
+               [](const auto& face) { return face.is_planar(); });
+}
+
+template<typename Element>
+inline auto is_face_planar(const CompactElement<Element>& element,
+                           const std::size_t face_idx) -> bool {
+  const auto& face = element.faces[face_idx];
+  const auto& mapping = Element::face_vertex_mapping[face_idx];
+
+  return std::all_of(std::begin(mapping),
+                     std::begin(mapping) + Element::face_vertex_count[face_idx],
+                     [&](const uint32_t vertex_idx) {
+                       return std::abs(face.normal.dot(
+                                  element.vertices[vertex_idx] -
+                                  face.center)) <= large_epsilon;
+                     });
+}
+
+template<typename Element, typename = std::enable_if_t<is_element_v<Element>>>
+inline auto intersects_coarse(const Sphere& sphere, const Element& element)
+    -> bool {
+  using AABB = Eigen::AlignedBox<Scalar, 3>;
+
+  const auto sphere_aabb =
+      AABB{sphere.center - Vector::Constant(sphere.radius),
+           sphere.center + Vector::Constant(sphere.radius)};
+
+  auto element_aabb = AABB{};
+  for (const auto& v : element.vertices) {
+    element_aabb.extend(v);
+  }
+
+  return sphere_aabb.intersects(element_aabb);
+}
+
+template<typename Element, typename Index>
+inline auto intersects_coarse(const Sphere& sphere,
+                              const ElementView<Element, Index>& view) -> bool {
+  using AABB = Eigen::AlignedBox<Scalar, 3>;
+
+  const auto sphere_aabb =
+      AABB{sphere.center - Vector::Constant(sphere.radius),
+           sphere.center + Vector::Constant(sphere.radius)};
+
+  auto element_aabb = AABB{};
+  for (auto idx = 0u; idx < num_vertices<Element>(); ++idx) {
+    element_aabb.extend(view.vertex(idx));
+  }
+
+  return sphere_aabb.intersects(element_aabb);
+}
+
+inline auto line_sphere_intersection(const Vector& base,
+                                     const Vector& direction,
+                                     const Sphere& sphere)
+    -> std::array<std::optional<Scalar>, 2> {
+  const auto a = direction.squaredNorm();
+  if (a == Scalar{0}) {
+    return std::array<std::optional<Scalar>, 2>{};
+  }
+
+  const auto origin_relative = (base - sphere.center).eval();
+  const auto b = Scalar{2} * direction.dot(origin_relative);
+  const auto c = origin_relative.squaredNorm() - sphere.radius * sphere.radius;
+
+  const auto discriminant = b * b - Scalar{4} * a * c;
+  if (discriminant > Scalar{0}) {
+    // two real roots
+    const auto q =
+        Scalar{-0.5} * (b + std::copysign(std::sqrt(discriminant), b));
+
+    auto x1 = q / a;
+    auto x2 = c / q;
+
+    if (x1 > x2) {
+      std::swap(x1, x2);
+    }
+
+    // if the midpoint of the two intersection points is not inside the sphere,
+    // the intersection is spurious
+    if (((base + (Scalar{0.5} * (x1 + x2)) * direction) - sphere.center)
+            .squaredNorm() >= sphere.radius * sphere.radius) {
+      return std::array<std::optional<Scalar>, 2>{};
+    }
+
+    return std::array{std::make_optional(x1), std::make_optional(x2)};
+  }
+
+  if (std::abs(discriminant) == Scalar{0}) {
+    // double real root, line tangential to the sphere's surface
+    return std::array{std::make_optional((Scalar{-0.5} * b) / a),
+                      std::optional<Scalar>{}};
+  }
+
+  // no real roots
+  return std::array<std::optional<Scalar>, 2>{};
+}
+
+// Calculate the volume of a regularized spherical wedge defined by the
+// radius, the distance of the intersection point from the center of the
+// sphere and the angle.
+inline auto regularized_wedge(Scalar r, Scalar d, Scalar alpha) -> Scalar {
+#ifndef NDEBUG
+  // clamp slight deviations of the angle to valid range
+  if (alpha < Scalar{0} && alpha > -detail::tiny_epsilon) {
+    alpha = Scalar{0};
+  }
+
+  if (alpha > Scalar{0.5} * pi && alpha <= Scalar{0.5} * pi + tiny_epsilon) {
+    alpha = Scalar{0.5} * pi;
+  }
+#endif
+
+  overlap_assert(r > Scalar{0}, "invalid argument 'r' for regularized_wedge()");
+
+  overlap_assert(d >= Scalar{0} && d <= r,
+                 "invalid argument 'd' for regularized_wedge()");
+
+  overlap_assert(alpha >= Scalar{0} && alpha <= Scalar{0.5} * pi,
+                 "invalid argument 'alpha' for regularized_wedge()");
+
+  const auto sin_alpha = std::sin(alpha);
+  const auto cos_alpha = std::cos(alpha);
+
+  const auto a = d * sin_alpha;
+  const auto b = std::sqrt(std::abs(r * r - d * d));
+  const auto c = d * cos_alpha;
+
+  return (Scalar{1} / Scalar{3}) * a * b * c +
+         a * ((Scalar{1} / Scalar{3}) * a * a - r * r) * std::atan2(b, c) +
+         (Scalar{2} / Scalar{3}) * r * r * r *
+             std::atan2(sin_alpha * b, cos_alpha * r);
+}
+
+// Wrapper around the above function handling correctly handling the case of
+// alpha > pi/2 and negative z.
+inline auto regularized_wedge(Scalar r, Scalar d, Scalar alpha, Scalar z)
+    -> Scalar {
+  if (z >= Scalar{0}) {
+    if (alpha > Scalar{0.5} * pi) {
+      const auto h = r - z;
+
+      return (pi / Scalar{3}) * h * h * (Scalar{3} * r - h) -
+             regularized_wedge(r, d, pi - alpha);
+    }
+
+    return regularized_wedge(r, d, alpha);
+  }
+
+  const auto hemisphere_volume = ((Scalar{2} / Scalar{3}) * pi) * r * r * r;
+  if (alpha > Scalar{0.5} * pi) {
+    return hemisphere_volume - regularized_wedge(r, d, pi - alpha);
+  }
+
+  const auto h = r + z;
+  const auto cap_volume = (pi / Scalar{3}) * h * h * (Scalar{3} * r - h);
+
+  return hemisphere_volume - (cap_volume - regularized_wedge(r, d, alpha));
+}
+
+// Calculate the surface area of a regularized spherical wedge defined by the
+// radius, the distance of the intersection point from the center of the
+// sphere and the angle.
+// Ref: Gibson, K. D. & Scheraga, H. A.: Exact calculation of the volume and
+//    surface area of fused hard-sphere molecules with unequal atomic radii,
+//    Molecular Physics, 1987, 62, 1247-1265
+inline auto regularized_wedge_area(Scalar r, Scalar z, Scalar alpha) -> Scalar {
+#ifndef NDEBUG
+  // clamp slight deviations of the angle to valid range
+  if (alpha < Scalar{0} && alpha > -tiny_epsilon) {
+    alpha = Scalar{0};
+  }
+
+  if (alpha > pi && alpha <= pi + tiny_epsilon) {
+    alpha = pi;
+  }
+#endif
+
+  overlap_assert(r > Scalar{0},
+                 "invalid argument 'r' for regularized_wedge_area()");
+
+  overlap_assert(z >= -r && z <= r,
+                 "invalid argument 'z' for regularized_wedge_area()");
+
+  overlap_assert(alpha >= Scalar{0} && alpha <= pi,
+                 "invalid argument 'alpha' for regularized_wedge_area()");
+
+  if (alpha < tiny_epsilon || std::abs(r * r - z * z) <= tiny_epsilon) {
+    return Scalar{0};
+  }
+
+  const auto sin_alpha = std::sin(alpha);
+  const auto cos_alpha = std::cos(alpha);
+  const auto factor = Scalar{1} / std::sqrt(std::abs(r * r - z * z));
+
+  // clamp slight deviations of the argument to acos() to valid range
+  const auto arg0 =
+      clamp(r * cos_alpha * factor, Scalar{-1}, Scalar{1}, tiny_epsilon);
+
+  const auto arg1 = clamp((z * cos_alpha * factor) / sin_alpha, Scalar{-1},
+                          Scalar{1}, tiny_epsilon);
+
+  overlap_assert(Scalar{-1} <= arg0 && arg0 <= Scalar{1},
+                 "invalid value for arg0 in regularized_wedge_area()");
+
+  overlap_assert(Scalar{-1} <= arg1 && arg1 <= Scalar{1},
+                 "invalid value for arg1 in regularized_wedge_area()");
+
+  return Scalar{2} * r * (r * std::acos(arg0) - z * std::acos(arg1));
+}
+
+// calculate the volume of the spherical wedge or the area of the spherical
+// lune, depending on the dimensionality
+template<std::size_t Dim>
+inline auto spherical_wedge(const Sphere& s, const Scalar angle) -> Scalar {
+  static_assert(Dim == 2 || Dim == 3, "invalid dimensionality, must be 2 or 3");
+
+  if constexpr (Dim == 2) {
+    return Scalar{2} * s.radius * s.radius * angle;
+  }
+
+  return (Scalar{2} / Scalar{3}) * s.radius * s.radius * s.radius * angle;
+}
+
+// Depending on the dimensionality, either the volume or external surface area
+// of the general wedge is computed.
+template<std::size_t Dim, typename Arithmetic = RobustArithmetic>
+inline auto general_wedge(const Sphere& s, const Plane& p0, const Plane& p1,
+                          const Vector& d) -> Scalar {
+  static_assert(Dim == 2 || Dim == 3, "invalid dimensionality, must be 2 or 3");
+
+  const auto dist = Arithmetic::norm(d);
+  if (dist < tiny_epsilon) {
+    // the wedge (almost) touches the center, the volume/area depends only on
+    // the angle
+    return spherical_wedge<Dim>(
+        s, pi - angle<Arithmetic>(p0.normal, p1.normal));
+  }
+
+  if (dist >= s.radius) {
+    // intersection of the two planes (numerically) on the surface of the
+    // sphere
+    return Scalar{0};
+  }
+
+  const auto s0 = d.dot(p0.normal);
+  const auto s1 = d.dot(p1.normal);
+
+  // detect degenerated general spherical wedge that can be treated as
+  // a regularized spherical wedge
+  if (std::abs(s0) < tiny_epsilon || std::abs(s1) < tiny_epsilon) {
+    const auto alpha = pi - angle<Arithmetic>(p0.normal, p1.normal);
+
+    if constexpr (Dim == 2) {
+      return regularized_wedge_area(
+          s.radius, std::abs(s0) > std::abs(s1) ? s0 : s1, alpha);
+    }
+
+    return regularized_wedge(s.radius, dist, alpha,
+                             std::abs(s0) > std::abs(s1) ? s0 : s1);
+  }
+
+  auto d_unit = Vector{d * (Scalar{1} / dist)};
+  if constexpr (Arithmetic::orthonormalize) {
+    if (dist < large_epsilon) {
+      d_unit = gram_schmidt(p0.normal.cross(p1.normal).stableNormalized(),
+                            d_unit)[1];
+    }
+  }
+
+  overlap_assert(p0.normal.dot(p1.center - p0.center) <= Scalar{0},
+                 "invalid plane in general_wedge()");
+
+  overlap_assert(p1.normal.dot(p0.center - p1.center) <= Scalar{0},
+                 "invalid plane in general_wedge()");
+
+  // calculate the angles between the vector from the sphere center
+  // to the intersection line and the normal vectors of the two planes
+  auto alpha0 = angle<Arithmetic>(p0.normal, d_unit);
+  auto alpha1 = angle<Arithmetic>(p1.normal, d_unit);
+
+  const auto pi_half = Scalar{0.5} * pi;
+  const auto dir0 = d_unit.dot((s.center + d) - p0.center);
+  const auto dir1 = d_unit.dot((s.center + d) - p1.center);
+
+  if (s0 >= Scalar{0} && s1 >= Scalar{0}) {
+    alpha0 = pi_half - std::copysign(alpha0, dir0);
+    alpha1 = pi_half - std::copysign(alpha1, dir1);
+
+    if constexpr (Dim == 2) {
+      return regularized_wedge_area(s.radius, s0, alpha0) +
+             regularized_wedge_area(s.radius, s1, alpha1);
+    }
+
+    return regularized_wedge(s.radius, dist, alpha0, s0) +
+           regularized_wedge(s.radius, dist, alpha1, s1);
+  }
+
+  if (s0 < Scalar{0} && s1 < Scalar{0}) {
+    alpha0 = pi_half + std::copysign(Scalar{1}, dir0) * (alpha0 - pi);
+    alpha1 = pi_half + std::copysign(Scalar{1}, dir1) * (alpha1 - pi);
+
+    if constexpr (Dim == 2) {
+      return s.surface_area() - (regularized_wedge_area(s.radius, -s0, alpha0) +
+                                 regularized_wedge_area(s.radius, -s1, alpha1));
+    }
+
+    return s.volume - (regularized_wedge(s.radius, dist, alpha0, -s0) +
+                       regularized_wedge(s.radius, dist, alpha1, -s1));
+  }
+
+  alpha0 = pi_half - std::copysign(Scalar{1}, dir0 * s0) *
+                         (alpha0 - (s0 < Scalar{0} ? pi : Scalar{0}));
+
+  alpha1 = pi_half - std::copysign(Scalar{1}, dir1 * s1) *
+                         (alpha1 - (s1 < Scalar{0} ? pi : Scalar{0}));
+
+  if constexpr (Dim == 2) {
+    const auto area0 = regularized_wedge_area(s.radius, std::abs(s0), alpha0);
+    const auto area1 = regularized_wedge_area(s.radius, std::abs(s1), alpha1);
+
+    return std::max(area0, area1) - std::min(area0, area1);
+  }
+
+  const auto volume0 = regularized_wedge(s.radius, dist, alpha0, std::abs(s0));
+  const auto volume1 = regularized_wedge(s.radius, dist, alpha1, std::abs(s1));
+
+  return std::max(volume0, volume1) - std::min(volume0, volume1);
+}
+
+template<typename Element>
+using EdgeIntersections =
+    std::array<std::optional<std::array<Vector, 2>>, num_edges<Element>()>;
+
+// Depending on the dimensionality, either the volume or external surface area
+// of the general wedge is computed.
+template<std::size_t Dim, typename Element,
+         typename Arithmetic = RobustArithmetic>
+auto general_wedge(const Sphere& sphere, const Element& element,
+                   std::size_t edge,
+                   const EdgeIntersections<Element>& intersections) {
+  static_assert(Dim == 2 || Dim == 3, "invalid dimensionality, must be 2 or 3");
+
+  const auto& f0 = element.faces[Element::edge_mapping[edge][1][0]];
+  const auto& f1 = element.faces[Element::edge_mapping[edge][1][1]];
+
+  overlap_assert(intersections[edge].has_value(),
+                 "inconsistent intersection detection for edge");
+
+  const auto edge_midpoint = Vector{
+      Scalar{0.5} * (((*intersections[edge])[0] +
+                      element.vertices[Element::edge_mapping[edge][0][0]]) +
+                     ((*intersections[edge])[1] +
+                      element.vertices[Element::edge_mapping[edge][0][1]]))};
+
+  const auto p0 = Plane{f0.center, f0.normal};
+  const auto p1 = Plane{f1.center, f1.normal};
+
+  return general_wedge<Dim, Arithmetic>(sphere, p0, p1,
+                                        edge_midpoint - sphere.center);
+}
+
+// Fixed-size set of flags packed into a single integer. In contrast to
+// std::bitset, all operations are constexpr and compile to plain integer
+// arithmetic, which matters in the per-query intersection bookkeeping.
+template<std::size_t N>
+class BitMask {
+  static_assert(N <= 32, "BitMask supports at most 32 flags.");
+
+ public:
+  using Storage = std::uint32_t;
+
+  constexpr BitMask() noexcept = default;
+
+  constexpr explicit BitMask(const Storage bits) noexcept
+      : bits_{bits & all_bits} {}
+
+  [[nodiscard]] static constexpr auto size() noexcept -> std::size_t {
+    return N;
+  }
+
+  [[nodiscard]] constexpr auto operator[](const std::size_t idx) const noexcept
+      -> bool {
+    return ((bits_ >> idx) & Storage{1}) != 0u;
+  }
+
+  constexpr auto set(const std::size_t idx, const bool value = true) noexcept
+      -> BitMask& {
+    const auto bit = Storage{1} << idx;
+    bits_ = value ? (bits_ | bit) : (bits_ & ~bit);
+
+    return *this;
+  }
+
+  [[nodiscard]] constexpr auto count() const noexcept -> std::size_t {
+    auto bits = bits_;
+    auto count = std::size_t{0};
+    for (; bits != 0u; bits &= bits - 1u) {
+      ++count;
+    }
+
+    return count;
+  }
+
+  [[nodiscard]] constexpr auto any() const noexcept -> bool {
+    return bits_ != 0u;
+  }
+
+  [[nodiscard]] constexpr auto none() const noexcept -> bool {
+    return bits_ == 0u;
+  }
+
+  [[nodiscard]] constexpr auto bits() const noexcept -> Storage {
+    return bits_;
+  }
+
+  [[nodiscard]] constexpr auto operator==(const BitMask& other) const noexcept
+      -> bool {
+    return bits_ == other.bits_;
+  }
+
+  [[nodiscard]] constexpr auto operator!=(const BitMask& other) const noexcept
+      -> bool {
+    return bits_ != other.bits_;
+  }
+
+ private:
+  static constexpr auto all_bits =
+      N == 32u ? ~Storage{0} : (Storage{1} << N) - 1u;
+
+  Storage bits_ = 0u;
+};
+
+// if not all three edges intersecting at a vertex are marked, the
+// sphere is only touching this vertex
+template<typename Element, typename = std::enable_if_t<is_element_v<Element>>>
+constexpr auto correct_marked_vertices(
+    const BitMask<num_vertices<Element>()>& marked_vertices,
+    const BitMask<num_edges<Element>()>& marked_edges)
+    -> BitMask<num_vertices<Element>()> {
+  auto corrected_marked_vertices = marked_vertices;
+
+  for (auto vertex_idx = 0u; vertex_idx < marked_vertices.size();
+       ++vertex_idx) {
+    if (!marked_vertices[vertex_idx]) {
+      continue;
+    }
+
+    // vertices joining more than three edges are not covered by the mapping
+    if (vertex_idx >= std::extent_v<decltype(Element::vertex_mapping), 0>) {
+      continue;
+    }
+
+    auto all_edges_marked = true;
+    for (auto local_edge_idx = 0u; local_edge_idx < 3u; ++local_edge_idx) {
+      const auto edge_idx =
+          Element::vertex_mapping[vertex_idx][0][local_edge_idx];
+      all_edges_marked &= marked_edges[edge_idx];
+    }
+
+    corrected_marked_vertices.set(vertex_idx, all_edges_marked);
+  }
+
+  return corrected_marked_vertices;
+}
+
+template<typename Element>
+struct EntityIntersections {
+  BitMask<num_vertices<Element>()> vertices;
+  BitMask<num_edges<Element>()> edges;
+  BitMask<num_faces<Element>()> faces;
+};
+
+template<typename Element>
+auto unit_sphere_intersections(const Element& element)
+    -> std::tuple<EntityIntersections<Element>, EdgeIntersections<Element>> {
+  const auto unit_sphere = Sphere{};
+
+  auto entity_intersections = EntityIntersections<Element>{};
+
+  // the intersection points between the single edges and the sphere are cached
+  auto edge_intersections = EdgeIntersections<Element>{};
+
+  for (auto edge_idx = 0u; edge_idx < num_edges<Element>(); ++edge_idx) {
+    const auto base = element.vertices[Element::edge_mapping[edge_idx][0][0]];
+    const auto direction =
+        (element.vertices[Element::edge_mapping[edge_idx][0][1]] - base).eval();
+
+    const auto&& intersections =
+        line_sphere_intersection(base, direction, unit_sphere);
+
+    // no intersection between the edge and the sphere, where touching
+    // (tangential) contacts are ignored
+    if (!intersections[1].has_value() || *intersections[0] >= Scalar{1} ||
+        *intersections[1] <= Scalar{0}) {
+      continue;
+    }
+
+    if (*intersections[0] < Scalar{0}) {
+      entity_intersections.vertices.set(Element::edge_mapping[edge_idx][0][0]);
+    }
+
+    if (*intersections[1] > Scalar{1}) {
+      entity_intersections.vertices.set(Element::edge_mapping[edge_idx][0][1]);
+    }
+
+    // note: the intersection points are relative to the vertices
+    edge_intersections[edge_idx] =
+        std::array<Vector, 2>{*intersections[0] * direction,
+                              (*intersections[1] - Scalar{1}) * direction};
+
+    entity_intersections.edges.set(edge_idx);
+
+    // if the edge is marked as having an overlap, the two faces forming it
+    // have to be marked as well
+    entity_intersections.faces.set(Element::edge_mapping[edge_idx][1][0]);
+    entity_intersections.faces.set(Element::edge_mapping[edge_idx][1][1]);
+  }
+
+  // check whether the dependencies for a vertex intersection are fulfilled
+  entity_intersections.vertices = correct_marked_vertices<Element>(
+      entity_intersections.vertices, entity_intersections.edges);
+
+  // check the interior of all faces for intersection with the unit sphere,
+  // skipping the faces already marked due to one of their edges
+  for (auto face_idx = 0u; face_idx < num_faces<Element>(); ++face_idx) {
+    if (!entity_intersections.faces[face_idx] &&
+        intersects_face(unit_sphere, element, face_idx)) {
+      entity_intersections.faces.set(face_idx);
+    }
+  }
+
+  return std::make_tuple(entity_intersections, edge_intersections);
+}
+
+// Correction at a vertex located inside the unit sphere and joining three
+// edges and faces. The intersection points of the edges with the sphere are
+// given relative to the vertex, along with the midpoints of the chords of the
+// edges inside the sphere. The planes of the faces are ordered according to
+// the 'face_mapping' table, i.e., face i is formed by the local edges listed
+// in the i-th entry of this table.
+template<std::size_t Dim, typename Arithmetic = RobustArithmetic>
+auto cone_correction(const Vector& vertex, const Vector& element_center,
+                     const std::array<Vector, 3>& relative_intersection_points,
+                     const std::array<Vector, 3>& chord_midpoints,
+                     const std::array<Plane, 3>& faces) -> Scalar {
+  static_assert(Dim == 2 || Dim == 3,
+                "invalid dimension for computation of correction at vertex");
+
+  static constexpr uint32_t face_mapping[3][2] = {{0, 1}, {0, 2}, {1, 2}};
+
+  auto intersection_points = std::array<Vector, 3>{};
+  for (auto local_edge_idx = 0u; local_edge_idx < 3; ++local_edge_idx) {
+    intersection_points[local_edge_idx] =
+        relative_intersection_points[local_edge_idx] + vertex;
+  }
+
+  // This triangle is constructed by hand to have more freedom of how
+  // the normal vector is calculated.
+  auto cone_triangle = Triangle{};
+  cone_triangle.vertices = {
+      {intersection_points[0], intersection_points[1], intersection_points[2]}};
+
+  cone_triangle.center =
+      (Scalar{1} / Scalar{3}) * std::accumulate(intersection_points.begin(),
+                                                intersection_points.end(),
+                                                Vector::Zero().eval());
+
+  // Calculate the normal of the triangle defined by the intersection
+  // points in relative coordinates to improve accuracy.
+  // Also use double the normal precision to calculate this normal.
+  cone_triangle.normal = Arithmetic::normal(relative_intersection_points[0],
+                                            relative_intersection_points[1],
+                                            relative_intersection_points[2]);
+
+  // The area of this triangle is never needed, so it is set to an
+  // invalid value.
+  cone_triangle.area = std::numeric_limits<Scalar>::infinity();
 
   auto distances = std::array<std::pair<std::size_t, Scalar>, 3>{};
   for (auto i = 0u; i < 3; ++i) {
@@ -1420,175 +2622,2471 @@ auto vertex_cone_correction(
         std::make_pair(i, relative_intersection_points[i].squaredNorm());
   }
 
-  std::sort(distances.begin(), distances.end(),
-            [](const std::pair<std::size_t, Scalar>& a,
-               const std::pair<std::size_t, Scalar>& b) {
-              return a.second < b.second;
-            });
+  std::sort(distances.begin(), distances.end(),
+            [](const std::pair<std::size_t, Scalar>& a,
+               const std::pair<std::size_t, Scalar>& b) {
+              return a.second < b.second;
+            });
+
+  const auto unit_sphere = Sphere{};
+
+  if (distances[1].second < distances[2].second * detail::large_epsilon) {
+    // Use the general spherical wedge defined by the edge with the
+    // non-degenerated intersection point and the normals of the
+    // two faces forming it. Local edge i is shared by the faces listed in the
+    // i-th entry of the face mapping.
+    const auto edge = distances[2].first;
+    return general_wedge<Dim, Arithmetic>(
+        unit_sphere, faces[face_mapping[edge][0]], faces[face_mapping[edge][1]],
+        chord_midpoints[edge] - unit_sphere.center);
+  }
+
+  // Make sure the normal points in the right direction i.e. away from
+  // the center of the element.
+  if (cone_triangle.normal.dot(element_center - cone_triangle.center) >
+      Scalar{0}) {
+    cone_triangle.normal = -cone_triangle.normal;
+  }
+
+  // Calculate the volume/surface area of the three spherical segments between
+  // the faces joining at the vertex and the plane through the intersection
+  // points.
+  auto segment_correction = [&]() {
+    const auto plane = Plane{cone_triangle.center, cone_triangle.normal};
+    const auto local_face_indices = {0u, 1u, 2u};
+    return std::accumulate(
+        std::begin(local_face_indices), std::end(local_face_indices), Scalar{0},
+        [&](const Scalar initial, const auto local_face_idx) {
+          const auto& face = faces[local_face_idx];
+
+          const auto center =
+              (Scalar{0.5} *
+               (intersection_points[face_mapping[local_face_idx][0]] +
+                intersection_points[face_mapping[local_face_idx][1]]))
+                  .eval();
+
+          return initial + general_wedge<Dim, Arithmetic>(
+                               unit_sphere, plane,
+                               Plane{face.center, -face.normal}, center);
+        });
+  };
+
+  const auto dist = cone_triangle.normal.dot(-cone_triangle.center);
+
+  if constexpr (Dim == 2) {
+    const auto cap_surface =
+        unit_sphere.cap_surface_area(unit_sphere.radius + dist);
+
+    // If cap surface area is small, the corrections will be even smaller. There
+    // is no way to actually calculate them with reasonable precision, so they
+    // are just ignored.
+    if (cap_surface < large_epsilon) {
+      return Scalar{0};
+    }
+
+    // Calculate the surface area of the cone and clamp it to zero.
+    return std::max(cap_surface - segment_correction(), Scalar{0});
+  } else if constexpr (Dim == 3) {
+    const auto tip_tet_volume =
+        (Scalar{1} / Scalar{6}) *
+        std::abs(-relative_intersection_points[2].dot(
+            (relative_intersection_points[0] - relative_intersection_points[2])
+                .cross(relative_intersection_points[1] -
+                       relative_intersection_points[2])));
+
+    const auto cap_volume = unit_sphere.cap_volume(unit_sphere.radius + dist);
+
+    // The cap volume is tiny, so the corrections will be even smaller. There is
+    // no way to actually calculate them with reasonable precision, so just the
+    // volume of the tetrahedron at the tip is used.
+    if (cap_volume < tiny_epsilon) {
+      return tip_tet_volume;
+    }
+
+    // Calculate the volume of the cone and clamp it to zero.
+    return std::max(tip_tet_volume + cap_volume - segment_correction(),
+                    Scalar{0});
+  }
+
+  return Scalar{};
+}
+
+template<std::size_t Dim, typename Element,
+         typename Arithmetic = RobustArithmetic>
+auto vertex_cone_correction(
+    const Element& element,
+    const EdgeIntersections<Element>& edge_intersections,
+    const std::size_t vertex_idx) -> Scalar {
+  // Collect the points where the three edges intersecting at this
+  // vertex intersect the sphere, together with the midpoints of the chords.
+  auto relative_intersection_points = std::array<Vector, 3>{};
+  auto chord_midpoints = std::array<Vector, 3>{};
+  for (auto local_edge_idx = 0u; local_edge_idx < 3; ++local_edge_idx) {
+    const auto edge_idx =
+        Element::vertex_mapping[vertex_idx][0][local_edge_idx];
+
+    overlap_assert(edge_intersections[edge_idx].has_value(),
+                   "inconsistent intersection detection for edge");
+
+    relative_intersection_points[local_edge_idx] =
+        (*edge_intersections[edge_idx])
+            [Element::vertex_mapping[vertex_idx][1][local_edge_idx]];
+
+    const auto& v0 = element.vertices[Element::edge_mapping[edge_idx][0][0]];
+    const auto& v1 = element.vertices[Element::edge_mapping[edge_idx][0][1]];
+    chord_midpoints[local_edge_idx] =
+        Scalar{0.5} * (((*edge_intersections[edge_idx])[0] + v0) +
+                       ((*edge_intersections[edge_idx])[1] + v1));
+  }
+
+  auto faces = std::array<Plane, 3>{};
+  for (auto local_face_idx = 0u; local_face_idx < 3; ++local_face_idx) {
+    const auto& face =
+        element.faces[Element::vertex_mapping[vertex_idx][2][local_face_idx]];
+    faces[local_face_idx] = Plane{face.center, face.normal};
+  }
+
+  return cone_correction<Dim, Arithmetic>(
+      element.vertices[vertex_idx], element.center,
+      relative_intersection_points, chord_midpoints, faces);
+}
+
+// Estimate the condition number of the general wedge at an edge of the
+// (normalized) element. Errors in the direction towards the intersection line
+// are amplified by the inverse distance of the line from the center of the
+// sphere, errors in the angles by the inverse sine of the dihedral angle.
+template<typename Element>
+auto wedge_condition(const Element& element, const std::size_t edge_idx,
+                     const EdgeIntersections<Element>& edge_intersections)
+    -> Scalar {
+  overlap_assert(edge_intersections[edge_idx].has_value(),
+                 "inconsistent intersection detection for edge");
+
+  const auto& mapping = Element::edge_mapping[edge_idx];
+  const auto& f0 = element.faces[mapping[1][0]];
+  const auto& f1 = element.faces[mapping[1][1]];
+
+  const auto edge_midpoint =
+      Vector{Scalar{0.5} * (((*edge_intersections[edge_idx])[0] +
+                             element.vertices[mapping[0][0]]) +
+                            ((*edge_intersections[edge_idx])[1] +
+                             element.vertices[mapping[0][1]]))};
+
+  const auto sin_angle = f0.normal.cross(f1.normal).norm();
+  const auto dist = edge_midpoint.norm();
+  if (sin_angle == Scalar{0}) {
+    return std::numeric_limits<Scalar>::infinity();
+  }
+
+  // close to the center, the volume only depends on the dihedral angle
+  const auto direction_condition =
+      dist < tiny_epsilon ? Scalar{0} : Scalar{1} / dist;
+
+  return Scalar{1} + direction_condition + Scalar{1} / sin_angle;
+}
+
+// Estimate the condition number of the cone correction at a vertex of the
+// (normalized) element, given by the aspect ratio of the triangle spanned by
+// the intersection points of the edges joining at the vertex and the sphere.
+// Each of the three segment corrections adds the condition of a wedge, taken
+// from the conditions already estimated for the edges, see wedge_condition().
+template<typename Element>
+auto cone_condition(const EdgeIntersections<Element>& edge_intersections,
+                    const std::array<Scalar, num_edges<Element>()>& conditions,
+                    const std::size_t vertex_idx) -> Scalar {
+  auto points = std::array<Vector, 3>{};
+  auto condition = Scalar{0};
+  for (auto local_edge_idx = 0u; local_edge_idx < 3u; ++local_edge_idx) {
+    const auto edge_idx =
+        Element::vertex_mapping[vertex_idx][0][local_edge_idx];
+
+    overlap_assert(edge_intersections[edge_idx].has_value(),
+                   "inconsistent intersection detection for edge");
+
+    points[local_edge_idx] =
+        (*edge_intersections[edge_idx])
+            [Element::vertex_mapping[vertex_idx][1][local_edge_idx]];
+
+    condition += conditions[edge_idx];
+  }
+
+  const auto double_area =
+      (points[1] - points[0]).cross(points[2] - points[0]).norm();
+
+  if (double_area == Scalar{0}) {
+    return std::numeric_limits<Scalar>::infinity();
+  }
+
+  const auto max_length_sq = std::max({(points[1] - points[0]).squaredNorm(),
+                                       (points[2] - points[1]).squaredNorm(),
+                                       (points[0] - points[2]).squaredNorm()});
+
+  return (max_length_sq / double_area) * (Scalar{1} + condition);
+}
+
+template<typename Element>
+inline auto has_planar_faces(const Element& element) noexcept -> bool {
+  for (auto face_idx = 0u; face_idx < num_faces<Element>(); ++face_idx) {
+    if (!is_face_planar(element, face_idx)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template<typename Element>
+inline auto detect_non_planar_faces(const Element& element) -> void {
+  if (!has_planar_faces(element)) {
+    throw std::invalid_argument{"non-planer face detected in element"};
+  }
+}
+
+// normalize the element w.r.t the unit sphere
+template<typename Element>
+inline auto normalize_element(const Sphere& sphere, const Element& element)
+    -> Element {
+  const auto transformation =
+      Transformation{-sphere.center, Scalar{1} / sphere.radius};
+
+  auto transformed_element = Element{element};
+  transformed_element.apply(transformation);
+
+  return transformed_element;
+}
+
+// Normalize the element w.r.t. the unit sphere, keeping only the data required
+// for the calculation of the overlap volume. The vertices and face planes are
+// transformed while creating the compact representation, so neither the full
+// element is copied nor are the face polygons transformed.
+template<typename Element>
+inline auto normalize_compact(const Sphere& sphere, const Element& element)
+    -> CompactElement<Element> {
+  return CompactElement<Element>{
+      element, Transformation{-sphere.center, Scalar{1} / sphere.radius}};
+}
+
+template<typename Element>
+inline auto normalize_compact(const Sphere& sphere,
+                              const CompactElement<Element>& element)
+    -> CompactElement<Element> {
+  return normalize_element(sphere, element);
+}
+
+// Intersection patterns of the unit sphere and a normalized element for which
+// dedicated kernels exist. All other patterns are handled by the general
+// inclusion-exclusion loops over all faces, edges and vertices.
+enum class IntersectionSignature : std::uint8_t {
+  face,    // a single face is intersected: spherical cap
+  edge,    // a single edge is intersected: two caps and one wedge
+  general  // any other combination of faces, edges and vertices
+};
+
+template<typename Element>
+auto intersection_signature(const EntityIntersections<Element>& intersections)
+    -> IntersectionSignature {
+  if (intersections.vertices.none()) {
+    const auto edge_count = intersections.edges.count();
+    const auto face_count = intersections.faces.count();
+
+    if (edge_count == 0u && face_count == 1u) {
+      return IntersectionSignature::face;
+    }
+
+    if (edge_count == 1u && face_count == 2u) {
+      return IntersectionSignature::edge;
+    }
+  }
+
+  return IntersectionSignature::general;
+}
+
+// index of the first set bit, or the size of the mask if none is set
+template<std::size_t N>
+constexpr auto first_set(const BitMask<N>& mask) -> std::size_t {
+  auto bits = mask.bits();
+  if (bits == 0u) {
+    return N;
+  }
+
+  auto idx = std::size_t{0};
+  for (; (bits & 1u) == 0u; bits >>= 1u) {
+    ++idx;
+  }
+
+  return idx;
+}
+
+// Overlap volume of the unit sphere and a normalized element intersecting only
+// a single face, given by the volume of the sphere minus the cap cut off.
+template<typename Element>
+auto face_overlap_volume(const Element& element, const std::size_t face_idx)
+    -> Scalar {
+  const auto unit_sphere = Sphere{};
+
+  const auto& face = element.faces[face_idx];
+  const auto dist = face.normal.dot(-face.center);
+
+  return unit_sphere.volume - unit_sphere.cap_volume(unit_sphere.radius + dist);
+}
+
+// Overlap volume of the unit sphere and a normalized element intersecting only
+// a single edge and the two faces forming it.
+template<typename Element>
+auto edge_overlap_volume(const Element& element, const std::size_t edge_idx,
+                         const EdgeIntersections<Element>& edge_intersections)
+    -> Scalar {
+  const auto unit_sphere = Sphere{};
+
+  const auto& f0 = element.faces[Element::edge_mapping[edge_idx][1][0]];
+  const auto& f1 = element.faces[Element::edge_mapping[edge_idx][1][1]];
+
+  const auto dist0 = f0.normal.dot(-f0.center);
+  const auto dist1 = f1.normal.dot(-f1.center);
+
+  return (unit_sphere.volume -
+          unit_sphere.cap_volume(unit_sphere.radius + dist0) -
+          unit_sphere.cap_volume(unit_sphere.radius + dist1)) +
+         general_wedge<3, Element>(unit_sphere, element, edge_idx,
+                                   edge_intersections);
+}
+
+// Overlap volume of the unit sphere and a normalized element for arbitrary
+// intersection patterns.
+template<typename Element>
+auto general_overlap_volume(
+    const Element& element,
+    const EntityIntersections<Element>& entity_intersections,
+    const EdgeIntersections<Element>& edge_intersections) -> Scalar {
+  const auto unit_sphere = Sphere{};
+
+  // initial value: volume of the full sphere
+  auto result = unit_sphere.volume;
+
+  // iterate over all the marked faces and subtract the volume of the cap cut
+  // off by the plane
+  for (auto face_idx = 0u; face_idx < num_faces<Element>(); ++face_idx) {
+    if (!entity_intersections.faces[face_idx]) {
+      continue;
+    }
+
+    const auto& face = element.faces[face_idx];
+    const auto dist = face.normal.dot(-face.center);
+
+    result -= unit_sphere.cap_volume(unit_sphere.radius + dist);
+  }
+
+  // handle the edges and add back the volume subtracted twice above in the
+  // processing of the faces
+  for (auto edge_idx = 0u; edge_idx < num_edges<Element>(); ++edge_idx) {
+    if (!entity_intersections.edges[edge_idx]) {
+      continue;
+    }
+
+    result += general_wedge<3, Element>(unit_sphere, element, edge_idx,
+                                        edge_intersections);
+  }
+
+  // handle the vertices and subtract the volume added twice above in the
+  // processing of the edges
+  for (auto vertex_idx = 0u; vertex_idx < num_vertices<Element>();
+       ++vertex_idx) {
+    if (!entity_intersections.vertices[vertex_idx]) {
+      continue;
+    }
+
+    result -=
+        vertex_cone_correction<3>(element, edge_intersections, vertex_idx);
+
+    // sanity check: detect negative intermediate result
+    overlap_assert(result > -std::sqrt(detail::tiny_epsilon),
+                   "negative intermediate result in overlap_volume()");
+  }
+
+  return result;
+}
+
+// Dispatch the calculation of the overlap volume of the unit sphere and a
+// normalized element to the kernel matching the intersection signature.
+template<typename Element>
+auto unit_overlap_volume(
+    const Element& element,
+    const EntityIntersections<Element>& entity_intersections,
+    const EdgeIntersections<Element>& edge_intersections) -> Scalar {
+  switch (intersection_signature(entity_intersections)) {
+    case IntersectionSignature::face:
+      return face_overlap_volume(element,
+                                 first_set(entity_intersections.faces));
+
+    case IntersectionSignature::edge:
+      return edge_overlap_volume(
+          element, first_set(entity_intersections.edges), edge_intersections);
+
+    case IntersectionSignature::general:
+      break;
+  }
+
+  return general_overlap_volume(element, entity_intersections,
+                                edge_intersections);
+}
+
+// Calculate the overlap volume of a sphere and an element that passed the
+// coarse intersection test and is not fully contained in the sphere.
+template<typename Element>
+auto exact_overlap_volume(const Sphere& sphere, const Element& element)
+    -> Scalar;
+
+// Calculate the overlap volume of a sphere and an element known to have only
+// planar faces, see has_planar_faces(). No exception is raised due to
+// non-planar faces. Only failed internal assertions may throw if
+// overlap_assert() is defined to do so.
+template<typename Element>
+auto validated_overlap_volume(const Sphere& sphere, const Element& element)
+    -> Scalar;
+
+// The corrections at the vertices located inside the sphere are restricted to
+// vertices joining three edges, which does not hold for the apex of a pyramid.
+// In this case, the pyramid is decomposed into two tetrahedra instead.
+template<typename Element>
+auto decomposed_overlap_volume(const Sphere& sphere, const Element& element)
+    -> Scalar {
+  auto tets = std::array<Tetrahedron, 2>{};
+  decompose(element, tets);
+
+  return std::accumulate(
+      std::begin(tets), std::end(tets), Scalar{0},
+      [&](const Scalar partial, const Tetrahedron& tet) {
+        if (!intersects_coarse(sphere, tet)) {
+          return partial;
+        }
+
+        // the faces of the tetrahedra are planar by construction
+        return partial + (contains(sphere, tet)
+                              ? tet.volume
+                              : validated_overlap_volume(sphere, tet));
+      });
+}
+
+// Calculate the overlap volume of the unit sphere and an element normalized
+// w.r.t. the sphere, see normalize_element(). The result refers to the
+// normalized objects and has to be scaled back by the caller.
+template<typename Element>
+auto normalized_overlap_volume(
+    const Element& transformed_element,
+    const EntityIntersections<Element>& entity_intersections,
+    const EdgeIntersections<Element>& edge_intersections) -> Scalar {
+  const auto unit_sphere = Sphere{};
+
+  // trivial case: the center of the sphere overlaps the element, but the sphere
+  // does not intersect any of the faces of the element, meaning the sphere is
+  // completely contained within the element
+  if (!entity_intersections.faces.count() &&
+      contains(transformed_element, unit_sphere.center)) {
+    return unit_sphere.volume;
+  }
+
+  // spurious intersection: The initial intersection test was positive, but the
+  // detailed checks revealed no overlap
+  if (!entity_intersections.vertices.count() &&
+      !entity_intersections.edges.count() &&
+      !entity_intersections.faces.count()) {
+    return Scalar{0};
+  }
+
+  if constexpr (is_pyramid_v<Element>) {
+    if (entity_intersections.vertices[Element::apex]) {
+      return decomposed_overlap_volume(unit_sphere, transformed_element);
+    }
+  }
+
+  auto result = unit_overlap_volume(transformed_element, entity_intersections,
+                                    edge_intersections);
+
+  // in case of different sized objects, the error can become quite large, so a
+  // relative limit is used
+  const auto max_overlap_volume =
+      std::min(unit_sphere.volume, transformed_element.volume);
+
+  const auto limit =
+      std::sqrt(std::numeric_limits<Scalar>::epsilon()) * max_overlap_volume;
+
+  // clamp tiny negative volumes to zero
+  if (result < Scalar{0} && result > -limit) {
+    return Scalar{0};
+  }
+
+  // clamp results slightly too large
+  if (result > max_overlap_volume && result - max_overlap_volume < limit) {
+    return max_overlap_volume;
+  }
+
+  // perform a final sanity check on the final result (debug version only)
+  overlap_assert(result >= Scalar{0} && result <= max_overlap_volume,
+                 "negative volume detected in overlap_volume()");
+
+  return result;
+}
+
+template<typename Element>
+auto normalized_overlap_volume(const Element& transformed_element) -> Scalar {
+  const auto&& [entity_intersections, edge_intersections] =
+      unit_sphere_intersections(transformed_element);
+
+  return normalized_overlap_volume(transformed_element, entity_intersections,
+                                   edge_intersections);
+}
+
+template<typename Element>
+auto validated_overlap_volume(const Sphere& sphere, const Element& element)
+    -> Scalar {
+  // skip the classification of the pyramid if its apex is clearly located
+  // inside the sphere
+  if constexpr (is_pyramid_v<Element>) {
+    const auto apex_dist_sq =
+        (element.vertices[Element::apex] - sphere.center).squaredNorm();
+
+    if (apex_dist_sq < (Scalar{1} - large_epsilon) * sphere.radius *
+                           sphere.radius) {
+      return decomposed_overlap_volume(sphere, element);
+    }
+  }
+
+  // use unit sphere and transformed (scaled and shifted) version of the element
+  const auto unit_sphere = Sphere{};
+  const auto result =
+      normalized_overlap_volume(normalize_compact(sphere, element));
+
+  // scale the overlap volume back for the original objects
+  return (result / unit_sphere.volume) * sphere.volume;
+}
+
+template<typename Element>
+auto exact_overlap_volume(const Sphere& sphere, const Element& element)
+    -> Scalar {
+  // sanity check: all faces of the mesh element have to be planar
+  detect_non_planar_faces(element);
+
+  return validated_overlap_volume(sphere, element);
+}
+
+inline auto intersects_coarse(const Sphere& sphere,
+                              const ConvexPolyhedron& polyhedron) -> bool {
+  using AABB = Eigen::AlignedBox<Scalar, 3>;
+
+  const auto sphere_aabb =
+      AABB{sphere.center - Vector::Constant(sphere.radius),
+           sphere.center + Vector::Constant(sphere.radius)};
+
+  auto polyhedron_aabb = AABB{};
+  for (const auto& v : polyhedron.vertices) {
+    polyhedron_aabb.extend(v);
+  }
+
+  return sphere_aabb.intersects(polyhedron_aabb);
+}
+
+inline auto contains(const ConvexPolyhedron& polyhedron, const Vector& p)
+    -> bool {
+  return std::all_of(std::begin(polyhedron.faces), std::end(polyhedron.faces),
+                     [&](const PolygonBase& face) {
+                       return face.normal.dot(p - face.center) <= Scalar{0};
+                     });
+}
+
+inline auto contains(const Sphere& sphere, const ConvexPolyhedron& polyhedron)
+    -> bool {
+  return std::all_of(std::begin(polyhedron.vertices),
+                     std::end(polyhedron.vertices), [&](const Vector& vertex) {
+                       return contains(sphere, vertex);
+                     });
+}
+
+// Fan tetrahedralization of the convex polyhedron, using the center of the
+// polyhedron as the common apex of the tetrahedra. The tetrahedra are passed
+// to the callback one at a time instead of being stored.
+template<typename Callback>
+void for_each_tetrahedron(const ConvexPolyhedron& polyhedron,
+                          Callback&& callback) {
+  for (auto face_idx = 0u; face_idx < polyhedron.num_faces(); ++face_idx) {
+    const auto& v0 = polyhedron.face_vertex(face_idx, 0);
+    for (auto idx = 1u; idx + 1 < polyhedron.face_vertex_count(face_idx);
+         ++idx) {
+      callback(Tetrahedron(v0, polyhedron.face_vertex(face_idx, idx + 1),
+                           polyhedron.face_vertex(face_idx, idx),
+                           polyhedron.center));
+    }
+  }
+}
+
+inline void decompose(const ConvexPolyhedron& polyhedron,
+                      std::vector<Tetrahedron>& tets) {
+  tets.clear();
+  for_each_tetrahedron(polyhedron,
+                       [&](const Tetrahedron& tet) { tets.push_back(tet); });
+}
+
+// The corrections at the vertices located inside the sphere are restricted to
+// vertices joining three edges. If other vertices are involved, the overlap
+// is computed based on the tetrahedralization of the polyhedron.
+inline auto decomposed_overlap_volume(const Sphere& sphere,
+                                      const ConvexPolyhedron& polyhedron)
+    -> Scalar {
+  auto result = Scalar{0};
+  for_each_tetrahedron(polyhedron, [&](const Tetrahedron& tet) {
+    if (!intersects_coarse(sphere, tet)) {
+      return;
+    }
+
+    // the faces of the tetrahedra are planar by construction
+    result += contains(sphere, tet) ? tet.volume
+                                    : validated_overlap_volume(sphere, tet);
+  });
+
+  return result;
+}
+
+// Overlap volume of a sphere and a convex polyhedron that passed the coarse
+// intersection test and is not fully contained in the sphere. Same scheme as
+// for the fixed element types, with the topology taken from the polyhedron.
+inline auto exact_overlap_volume(const Sphere& sphere,
+                                 const ConvexPolyhedron& polyhedron) -> Scalar {
+  using Flags = SmallVector<uint8_t, ConvexPolyhedron::inline_edges>;
+
+  for (auto face_idx = 0u; face_idx < polyhedron.num_faces(); ++face_idx) {
+    if (!polyhedron.is_face_planar(face_idx)) {
+      throw std::invalid_argument{"non-planar face detected in polyhedron"};
+    }
+  }
+
+  // use unit sphere and transformed (scaled and shifted) versions of the
+  // vertices and face planes, while the topology is taken from the polyhedron
+  // itself to avoid copying it
+  const auto unit_sphere = Sphere{};
+  const auto transformation =
+      Transformation{-sphere.center, Scalar{1} / sphere.radius};
+
+  const auto transform = [&](const Vector& v) {
+    return Vector{transformation.scaling * (v + transformation.translation)};
+  };
+
+  const auto num_edges = polyhedron.num_edges();
+  const auto num_vertices = polyhedron.num_vertices();
+  const auto num_faces = polyhedron.num_faces();
+
+  auto vertices = SmallVector<Vector, ConvexPolyhedron::inline_vertices>{};
+  for (const auto& v : polyhedron.vertices) {
+    vertices.push_back(transform(v));
+  }
+
+  auto planes = SmallVector<Plane, ConvexPolyhedron::inline_faces>{};
+  for (const auto& face : polyhedron.faces) {
+    planes.push_back(Plane{transform(face.center), face.normal});
+  }
+
+  const auto center = transform(polyhedron.center);
+  const auto face_vertex = [&](const std::size_t face_idx,
+                               const std::size_t idx) -> const Vector& {
+    const auto offset = polyhedron.face_offsets[face_idx];
+    return vertices[polyhedron.face_vertices[offset + idx]];
+  };
+
+  auto marked_edges = Flags(num_edges, 0);
+  auto marked_vertices = Flags(num_vertices, 0);
+  auto marked_faces = Flags(num_faces, 0);
+
+  // vertices are only marked if all of the edges joining there are marked
+  auto all_edges_marked = Flags(num_vertices, 1);
+  auto valence = SmallVector<uint32_t, ConvexPolyhedron::inline_vertices>(
+      num_vertices, 0);
+
+  // note: the intersection points are relative to the vertices
+  auto edge_intersections =
+      SmallVector<std::array<Vector, 2>, ConvexPolyhedron::inline_edges>(
+          num_edges, {Vector::Zero(), Vector::Zero()});
+
+  for (auto edge_idx = 0u; edge_idx < num_edges; ++edge_idx) {
+    const auto& edge = polyhedron.edges[edge_idx];
+    ++valence[edge.vertices[0]];
+    ++valence[edge.vertices[1]];
+
+    const auto base = vertices[edge.vertices[0]];
+    const auto direction = (vertices[edge.vertices[1]] - base).eval();
+
+    const auto&& intersections =
+        line_sphere_intersection(base, direction, unit_sphere);
+
+    if (!intersections[1].has_value() || *intersections[0] >= Scalar{1} ||
+        *intersections[1] <= Scalar{0}) {
+      all_edges_marked[edge.vertices[0]] = 0;
+      all_edges_marked[edge.vertices[1]] = 0;
+      continue;
+    }
+
+    marked_vertices[edge.vertices[0]] |= *intersections[0] < Scalar{0};
+    marked_vertices[edge.vertices[1]] |= *intersections[1] > Scalar{1};
+
+    edge_intersections[edge_idx] =
+        std::array<Vector, 2>{*intersections[0] * direction,
+                              (*intersections[1] - Scalar{1}) * direction};
+
+    marked_edges[edge_idx] = 1;
+    marked_faces[edge.faces[0]] = 1;
+    marked_faces[edge.faces[1]] = 1;
+  }
+
+  for (auto vertex_idx = 0u; vertex_idx < num_vertices; ++vertex_idx) {
+    marked_vertices[vertex_idx] &= all_edges_marked[vertex_idx];
+  }
+
+  for (auto face_idx = 0u; face_idx < num_faces; ++face_idx) {
+    const auto& plane = planes[face_idx];
+    marked_faces[face_idx] |=
+        intersects(unit_sphere, plane) &&
+        contains_projection(
+            polyhedron.face_vertex_count(face_idx),
+            [&](const std::size_t idx) -> const Vector& {
+              return face_vertex(face_idx, idx);
+            },
+            plane.center, plane.normal, unit_sphere.center);
+  }
+
+  const auto any = [](const Flags& flags) {
+    return std::any_of(std::begin(flags), std::end(flags),
+                       [](const uint8_t flag) { return flag != 0; });
+  };
+
+  // trivial case: sphere completely contained within the polyhedron
+  if (!any(marked_faces) &&
+      std::all_of(std::begin(planes), std::end(planes), [&](const Plane& p) {
+        return p.normal.dot(unit_sphere.center - p.center) <= Scalar{0};
+      })) {
+    return sphere.volume;
+  }
+
+  // spurious intersection
+  if (!any(marked_vertices) && !any(marked_edges) && !any(marked_faces)) {
+    return Scalar{0};
+  }
+
+  for (auto vertex_idx = 0u; vertex_idx < num_vertices; ++vertex_idx) {
+    if (marked_vertices[vertex_idx] && valence[vertex_idx] != 3u) {
+      return decomposed_overlap_volume(sphere, polyhedron);
+    }
+  }
+
+  // initial value: volume of the full sphere
+  auto result = unit_sphere.volume;
+
+  for (auto face_idx = 0u; face_idx < num_faces; ++face_idx) {
+    if (!marked_faces[face_idx]) {
+      continue;
+    }
+
+    const auto& face = planes[face_idx];
+    const auto dist = face.normal.dot(-face.center);
+
+    result -= unit_sphere.cap_volume(unit_sphere.radius + dist);
+  }
+
+  const auto chord_midpoint = [&](const std::size_t edge_idx) {
+    const auto& edge = polyhedron.edges[edge_idx];
+    return Vector{
+        Scalar{0.5} * ((edge_intersections[edge_idx][0] +
+                        vertices[edge.vertices[0]]) +
+                       (edge_intersections[edge_idx][1] +
+                        vertices[edge.vertices[1]]))};
+  };
+
+  for (auto edge_idx = 0u; edge_idx < num_edges; ++edge_idx) {
+    if (!marked_edges[edge_idx]) {
+      continue;
+    }
+
+    const auto& edge = polyhedron.edges[edge_idx];
+    result += general_wedge<3>(unit_sphere, planes[edge.faces[0]],
+                               planes[edge.faces[1]],
+                               chord_midpoint(edge_idx) - unit_sphere.center);
+  }
+
+  for (auto vertex_idx = 0u; vertex_idx < num_vertices; ++vertex_idx) {
+    if (!marked_vertices[vertex_idx]) {
+      continue;
+    }
+
+    // gather the three edges joining at the vertex
+    auto local_edges = std::array<uint32_t, 3>{};
+    auto local_edge_count = 0u;
+    for (auto edge_idx = 0u; edge_idx < num_edges; ++edge_idx) {
+      const auto& edge = polyhedron.edges[edge_idx];
+      if (edge.vertices[0] == vertex_idx || edge.vertices[1] == vertex_idx) {
+        local_edges[local_edge_count++] = edge_idx;
+      }
+    }
+
+    auto relative_intersection_points = std::array<Vector, 3>{};
+    auto chord_midpoints = std::array<Vector, 3>{};
+    for (auto local_edge_idx = 0u; local_edge_idx < 3u; ++local_edge_idx) {
+      const auto edge_idx = local_edges[local_edge_idx];
+      const auto end =
+          polyhedron.edges[edge_idx].vertices[0] == vertex_idx ? 0u : 1u;
+
+      relative_intersection_points[local_edge_idx] =
+          edge_intersections[edge_idx][end];
+      chord_midpoints[local_edge_idx] = chord_midpoint(edge_idx);
+    }
+
+    // local face i is the face shared by the local edges (0, 1), (0, 2) and
+    // (1, 2), respectively
+    static constexpr uint32_t face_mapping[3][2] = {{0, 1}, {0, 2}, {1, 2}};
+
+    auto faces = std::array<Plane, 3>{};
+    for (auto local_face_idx = 0u; local_face_idx < 3u; ++local_face_idx) {
+      const auto& e0 =
+          polyhedron.edges[local_edges[face_mapping[local_face_idx][0]]];
+      const auto& e1 =
+          polyhedron.edges[local_edges[face_mapping[local_face_idx][1]]];
+
+      const auto shared =
+          e0.faces[0] == e1.faces[0] || e0.faces[0] == e1.faces[1]
+              ? e0.faces[0]
+              : e0.faces[1];
+      faces[local_face_idx] = planes[shared];
+    }
+
+    result -= cone_correction<3>(vertices[vertex_idx], center,
+                                 relative_intersection_points, chord_midpoints,
+                                 faces);
+  }
+
+  // in case of different sized objects, the error can become quite large, so a
+  // relative limit is used
+  const auto scaling = transformation.scaling;
+  const auto max_overlap_volume = std::min(
+      unit_sphere.volume, polyhedron.volume * (scaling * scaling * scaling));
+
+  const auto limit =
+      std::sqrt(std::numeric_limits<Scalar>::epsilon()) * max_overlap_volume;
+
+  // clamp tiny negative volumes to zero
+  if (result < Scalar{0} && result > -limit) {
+    return Scalar{0};
+  }
+
+  // clamp results slightly too large
+  if (result > max_overlap_volume && result - max_overlap_volume < limit) {
+    return std::min(sphere.volume, polyhedron.volume);
+  }
+
+  overlap_assert(result >= Scalar{0} && result <= max_overlap_volume,
+                 "negative volume detected in overlap_volume()");
+
+  // scale the overlap volume back for the original objects
+  return (result / unit_sphere.volume) * sphere.volume;
+}
+
+// Signed overlap volume of a sphere and the tetrahedron spanned by a triangle
+// and a reference point. The vertices of the triangle are ordered
+// counterclockwise when viewed from the outside of the surface, so the sign is
+// positive if the reference point is located on the inner side of the
+// triangle. Tetrahedra rejected by the coarse test are never constructed.
+inline auto signed_overlap_volume(const Sphere& sphere,
+                                  const std::array<Vector, 3>& triangle,
+                                  const Vector& reference) -> Scalar {
+  const auto& [a, b, c] = triangle;
+
+  const auto orientation = (c - a).cross(b - a).dot(reference - a);
+  if (orientation == Scalar{0}) {
+    return Scalar{0};
+  }
+
+  using AABB = Eigen::AlignedBox<Scalar, 3>;
+
+  const auto sphere_aabb =
+      AABB{sphere.center - Vector::Constant(sphere.radius),
+           sphere.center + Vector::Constant(sphere.radius)};
+
+  auto tet_aabb = AABB{reference, reference};
+  tet_aabb.extend(a).extend(b).extend(c);
+
+  if (!sphere_aabb.intersects(tet_aabb)) {
+    return Scalar{0};
+  }
+
+  // reorder the vertices to obtain a positively oriented tetrahedron
+  const auto tet = orientation > Scalar{0} ? Tetrahedron{a, c, b, reference}
+                                           : Tetrahedron{a, b, c, reference};
+
+  const auto volume =
+      contains(sphere, tet) ? tet.volume : exact_overlap_volume(sphere, tet);
+
+  return orientation > Scalar{0} ? volume : -volume;
+}
+
+// Status reported by the non-throwing variants of the overlap calculations.
+enum class OverlapStatus : std::uint8_t {
+  success,
+  non_planar_face,
+};
+
+// Overlap volumes of a batch of sphere/element pairs computed without raising
+// exceptions, along with the indices of the elements which failed validation.
+// Pairs involving such an element yield a volume of zero.
+struct OverlapVolumes {
+  std::vector<Scalar> volumes;
+  std::vector<std::size_t> failed_elements;
+};
+
+// Result of the fast evaluation of the overlap volume: the estimated volume
+// and a first-order estimate of its absolute error.
+struct OverlapEstimate {
+  Scalar volume = Scalar{0};
+  Scalar error_estimate = Scalar{0};
+};
+
+// Overlap volumes of a sphere and the cells of an octree, see
+// overlap_volumes(). The volume of an inner cell is the sum of the volumes of
+// its children. The leaves contribute to the volume of their level.
+struct OctreeOverlap {
+  std::vector<Scalar> volumes;
+  std::vector<Scalar> level_volumes;
+};
+
+// Counters of the descent of the octree by overlap_volumes(). Leaves neither
+// contained in the sphere nor evaluated exactly belong to skipped subtrees
+// disjoint from the sphere. Not thread-safe, use one instance per thread and
+// combine them afterwards.
+struct OctreeStatistics {
+  auto operator+=(const OctreeStatistics& other) -> OctreeStatistics& {
+    queries += other.queries;
+    visited_nodes += other.visited_nodes;
+    contained_leaves += other.contained_leaves;
+    exact_leaves += other.exact_leaves;
+
+    return *this;
+  }
+
+  std::size_t queries = 0;           // spheres processed
+  std::size_t visited_nodes = 0;     // nodes tested against the sphere
+  std::size_t contained_leaves = 0;  // leaves assigned the volume of the cell
+  std::size_t exact_leaves = 0;      // leaves cut by the surface of the sphere
+};
+
+// Lower and upper bounds of the overlap volume, see overlap_volume_bounds().
+struct OverlapBounds {
+  Scalar lower = Scalar{0};
+  Scalar upper = Scalar{0};
+};
+
+// Overlap volume together with its derivatives w.r.t. the center and the
+// radius of the sphere, see overlap_volume_gradient().
+struct OverlapGradient {
+  Scalar volume = Scalar{0};
+  Vector center = Vector::Zero();
+  Scalar radius = Scalar{0};
+};
+
+// Overlap volume together with the first moment of the overlap region, i.e.,
+// the integral of the position over the region, see overlap_moments(). The
+// centroid of the overlap region is given by first_moment / volume.
+struct OverlapMoments {
+  Scalar volume = Scalar{0};
+  Vector first_moment = Vector::Zero();
+};
+
+// Derivatives of the overlap volume given the overlap areas of a sphere and an
+// element, see overlap_area(). Growing the sphere adds volume at the rate of
+// the sphere surface inside the element. Moving the sphere adds volume at the
+// rate of the area-weighted normal of this surface, which equals the negative
+// sum of the area-weighted normals of the faces inside the sphere as the
+// boundary of the overlap region is closed.
+template<typename Element, typename Areas>
+void gradient_from_areas(const Element& element, const Areas& areas,
+                         OverlapGradient& gradient) {
+  gradient.radius = areas[0];
+  gradient.center = Vector::Zero();
+  for (auto face_idx = 0u; face_idx < num_faces<Element>(); ++face_idx) {
+    gradient.center -= areas[face_idx + 1] * element.faces[face_idx].normal;
+  }
+}
+
+// Counters tracking how often the fast evaluation had to fall back to the
+// robust calculation. Not thread-safe, use one instance per thread and
+// combine them afterwards.
+struct FallbackStatistics {
+  [[nodiscard]] auto fallback_rate() const -> Scalar {
+    return evaluations > 0u
+               ? static_cast<Scalar>(fallbacks) /
+                     static_cast<Scalar>(evaluations)
+               : Scalar{0};
+  }
+
+  auto operator+=(const FallbackStatistics& other) -> FallbackStatistics& {
+    evaluations += other.evaluations;
+    fallbacks += other.fallbacks;
+
+    return *this;
+  }
+
+  std::size_t evaluations = 0;
+  std::size_t fallbacks = 0;
+};
+
+// Counters tracking how often the queries based on overlap_volume_bounds()
+// could not be decided by the bounds alone and required the exact calculation.
+// For overlap_owner(), each candidate element counts as one query. Not
+// thread-safe, use one instance per thread and combine them afterwards.
+struct BoundsStatistics {
+  [[nodiscard]] auto exact_rate() const -> Scalar {
+    return queries > 0u ? static_cast<Scalar>(exact_evaluations) /
+                              static_cast<Scalar>(queries)
+                        : Scalar{0};
+  }
+
+  auto operator+=(const BoundsStatistics& other) -> BoundsStatistics& {
+    queries += other.queries;
+    exact_evaluations += other.exact_evaluations;
+
+    return *this;
+  }
+
+  std::size_t queries = 0;
+  std::size_t exact_evaluations = 0;
+};
+
+// Timings and counters of the stages of the batched pipeline processing
+// sphere/element pairs, see overlap_volume_pairs().
+struct PipelineStatistics {
+  std::chrono::nanoseconds coarse_time{0};
+  std::chrono::nanoseconds containment_time{0};
+  std::chrono::nanoseconds exact_time{0};
+
+  std::size_t pairs = 0;             // number of pairs processed
+  std::size_t coarse_survivors = 0;  // pairs passing the coarse test
+  std::size_t exact_pairs = 0;       // pairs requiring the exact calculation
+};
+
+using SphereElementPair = std::pair<std::size_t, std::size_t>;
+
+// Pipeline stage 1: coarse intersection test of all pairs, collecting the
+// indices of the pairs passing the test.
+template<typename Element>
+void coarse_stage(const std::vector<Sphere>& spheres,
+                  const std::vector<Element>& elements,
+                  const std::vector<SphereElementPair>& pairs,
+                  std::vector<std::size_t>& survivors) {
+  survivors.clear();
+  for (auto pair_idx = std::size_t{0}; pair_idx < pairs.size(); ++pair_idx) {
+    const auto [sphere_idx, element_idx] = pairs[pair_idx];
+    if (intersects_coarse(spheres[sphere_idx], elements[element_idx])) {
+      survivors.push_back(pair_idx);
+    }
+  }
+}
+
+// Pipeline stage 2: containment of the element in the sphere or vice versa,
+// resolving these pairs directly and collecting the remaining ones.
+template<typename Element>
+void containment_stage(const std::vector<Sphere>& spheres,
+                       const std::vector<Element>& elements,
+                       const std::vector<SphereElementPair>& pairs,
+                       const std::vector<std::size_t>& candidates,
+                       std::vector<Scalar>& results,
+                       std::vector<std::size_t>& remaining) {
+  remaining.clear();
+  for (const auto pair_idx : candidates) {
+    const auto& sphere = spheres[pairs[pair_idx].first];
+    const auto& element = elements[pairs[pair_idx].second];
+
+    if (contains(sphere, element)) {
+      results[pair_idx] = element.volume;
+    } else if (contains(element, sphere)) {
+      results[pair_idx] = sphere.volume;
+    } else {
+      remaining.push_back(pair_idx);
+    }
+  }
+}
+
+// Pipeline stage 3: exact calculation for the dense list of remaining pairs.
+template<typename Element>
+void exact_stage(const std::vector<Sphere>& spheres,
+                 const std::vector<Element>& elements,
+                 const std::vector<SphereElementPair>& pairs,
+                 const std::vector<std::size_t>& candidates,
+                 std::vector<Scalar>& results) {
+  for (const auto pair_idx : candidates) {
+    results[pair_idx] = exact_overlap_volume(spheres[pairs[pair_idx].first],
+                                             elements[pairs[pair_idx].second]);
+  }
+}
+
+// Surface areas of the unit sphere and of the faces of a normalized element
+// within each other, given the intersections found by
+// unit_sphere_intersections(). The entries are ordered as in the result of
+// overlap_area(), but the total area of the faces is left unset. The areas
+// refer to the normalized objects, see scale_overlap_area(). The surface area
+// of the sphere is only calculated if requested.
+template<bool SphereArea = true, typename Element>
+auto unit_overlap_area(const Element& transformed_element,
+                       const EntityIntersections<Element>& entity_intersections,
+                       const EdgeIntersections<Element>& edge_intersections)
+    -> std::array<Scalar, num_faces<Element>() + 2> {
+  const auto unit_sphere = Sphere{};
+
+  auto result = std::array<Scalar, num_faces<Element>() + 2>{};
+
+  // initial value for the surface of the sphere: Surface area of the full
+  // sphere
+  result[0] = unit_sphere.surface_area();
+
+  // iterate over all the marked faces and calculate the area of the disk
+  // defined by the plane as well as the cap surfaces
+  for (auto face_idx = 0u; face_idx < num_faces<Element>(); ++face_idx) {
+    if (!entity_intersections.faces[face_idx]) {
+      continue;
+    }
+
+    const auto& face = transformed_element.faces[face_idx];
+    const auto dist = face.normal.dot(-face.center);
+
+    result[0] -= unit_sphere.cap_surface_area(unit_sphere.radius + dist);
+    result[face_idx + 1] = unit_sphere.disk_area(unit_sphere.radius + dist);
+  }
+
+  const auto circular_segment_area = [](const Scalar radius_sq,
+                                        const Scalar chord_length) {
+    if (std::abs(radius_sq - Scalar{0.25} * chord_length * chord_length) <=
+        tiny_epsilon) {
+      return Scalar{0.5} * radius_sq * pi;
+    }
+
+    const auto apothem = std::sqrt(std::max(
+        Scalar{0}, radius_sq - Scalar{0.25} * chord_length * chord_length));
+
+    const auto theta =
+        Scalar{2} * std::atan2(chord_length, Scalar{2} * apothem);
+
+    const auto sector_area = Scalar{0.5} * radius_sq * theta;
+    const auto triangle_area = Scalar{0.5} * chord_length * apothem;
+
+    return sector_area - triangle_area;
+  };
+
+  // cache the squared radius of the disk formed by the intersection between the
+  // planes defined by each face and the sphere
+  auto intersection_radius_sq = std::array<Scalar, num_faces<Element>()>{};
+
+  // handle the edges and subtract the area of the respective disk cut off by
+  // the edge and add back the surface area of the spherical wedge defined by
+  // the edge
+  for (auto edge_idx = 0u; edge_idx < num_edges<Element>(); ++edge_idx) {
+    if (!entity_intersections.edges[edge_idx]) {
+      continue;
+    }
+
+    // intersection area of the the sphere: add back the surface area of the
+    // spherical wedge defined by the edge which was considered twice when
+    // processing the two faces forming the edge
+    if constexpr (SphereArea) {
+      result[0] += general_wedge<2, Element>(unit_sphere, transformed_element,
+                                             edge_idx, edge_intersections);
+    }
+
+    // intersection areas of the all faces: for each of the two faces forming
+    // the edge, remove the part of the disk area beyond the edge
+    //
+
+    overlap_assert(edge_intersections[edge_idx].has_value(),
+                   "inconsistent intersection detection for edge");
+
+    // the chord length is given by the distance of the intersection points of
+    // the sphere and the edge
+    const auto chord =
+        ((transformed_element.vertices[Element::edge_mapping[edge_idx][0][0]] +
+          (*edge_intersections[edge_idx])[0]) -
+         (transformed_element.vertices[Element::edge_mapping[edge_idx][0][1]] +
+          (*edge_intersections[edge_idx])[1]))
+            .eval();
+
+    const auto chord_length = chord.stableNorm();
+
+    // each edge belongs to two faces, indexed via
+    // Element::edge_mapping[n][1][{0,1}]
+    for (auto local_face_idx = 0u; local_face_idx < 2u; ++local_face_idx) {
+      const auto face_idx = Element::edge_mapping[edge_idx][1][local_face_idx];
+      const auto& face = transformed_element.faces[face_idx];
+
+      // height of the spherical cap cut off by the plane containing the face
+      const auto cap_height = unit_sphere.radius - face.normal.dot(face.center);
+      const auto apothem = unit_sphere.radius - cap_height;
+      intersection_radius_sq[face_idx] =
+          cap_height * (unit_sphere.radius + apothem);
+
+      // the part of the base of the spherical cap cut off by the edge
+      auto segment_area =
+          circular_segment_area(intersection_radius_sq[face_idx], chord_length);
+
+      const auto chord_center =
+          (Scalar{0.5} *
+           ((transformed_element
+                 .vertices[Element::edge_mapping[edge_idx][0][0]] +
+             (*edge_intersections[edge_idx])[0]) +
+            (transformed_element
+                 .vertices[Element::edge_mapping[edge_idx][0][1]] +
+             (*edge_intersections[edge_idx])[1])))
+              .eval();
+
+      // projection of the center of the sphere onto the face
+      const auto proj =
+          (unit_sphere.center -
+           face.normal.dot(unit_sphere.center - face.center) * face.normal)
+              .eval();
+
+      // if the projected sphere center and the face center fall on opposite
+      // sides of the edge, the area has to be inverted
+      const auto invert_segment_area =
+          chord.cross(proj - chord_center)
+              .dot(chord.cross(face.center - chord_center)) < Scalar{0};
+
+      if (invert_segment_area) {
+        segment_area = intersection_radius_sq[face_idx] * pi - segment_area;
+      }
+
+      result[face_idx + 1] -= segment_area;
+    }
+  }
+
+  for (auto vertex_idx = 0u; vertex_idx < num_vertices<Element>();
+       ++vertex_idx) {
+    if (!entity_intersections.vertices[vertex_idx]) {
+      continue;
+    }
+
+    //
+    // correct the intersection area of the the sphere
+    //
+    if constexpr (SphereArea) {
+      result[0] -= vertex_cone_correction<2>(transformed_element,
+                                             edge_intersections, vertex_idx);
+
+      // sanity checks: detect negative/excessively large intermediate result
+      overlap_assert(result[0] > -std::sqrt(detail::tiny_epsilon),
+                     "negative area as intermediate result in overlap_area()");
+
+      overlap_assert(
+          result[0] < unit_sphere.surface_area() + detail::tiny_epsilon,
+          "invalid intermediate result in overlap_area()");
+    }
+
+    //
+    // correct the intersection areas of all facets
+    //
+    // iterate over all the faces joining at this vertex
+    for (auto local_face_idx = 0u; local_face_idx < 3u; ++local_face_idx) {
+      // determine the two edges of this face intersecting at the vertex
+      const auto edge0 = Element::face_mapping[local_face_idx][0];
+      const auto edge1 = Element::face_mapping[local_face_idx][1];
+      const auto edge_indices =
+          std::array{Element::vertex_mapping[vertex_idx][0][edge0],
+                     Element::vertex_mapping[vertex_idx][0][edge1]};
+
+      // extract the (relative) intersection points of these edges with the
+      // sphere furthest from the vertex
+      overlap_assert(edge_intersections[edge_indices[0]].has_value() &&
+                         edge_intersections[edge_indices[1]].has_value(),
+                     "inconsistent intersection detection for edge");
+
+      const auto intersection_points =
+          std::array{(*edge_intersections[edge_indices[0]])
+                         [Element::vertex_mapping[vertex_idx][1][edge0]],
+
+                     (*edge_intersections[edge_indices[1]])
+                         [Element::vertex_mapping[vertex_idx][1][edge1]]};
+
+      // together with the vertex, this determines the triangle representing one
+      // part of the correction
+      const auto triangle_area =
+          Scalar{0.5} *
+          (intersection_points[0].cross(intersection_points[1])).stableNorm();
+
+      // the second component is the segment defined by the face and the
+      // intersection points
+      const auto chord_length =
+          (intersection_points[0] - intersection_points[1]).stableNorm();
+
+      const auto face_idx =
+          Element::vertex_mapping[vertex_idx][2][local_face_idx];
+
+      auto segment_area =
+          circular_segment_area(intersection_radius_sq[face_idx], chord_length);
+
+      // determine if the (projected) center of the sphere lies within the
+      // triangle or not; if not, the segment area has to be corrected
+      const auto chord_center =
+          (Scalar{0.5} * (intersection_points[0] + intersection_points[1]))
+              .eval();
+
+      const auto& face = transformed_element.faces[face_idx];
+      const auto proj = (-face.normal.dot(-face.center) * face.normal).eval();
+      const auto invert_segment_area =
+          chord_center.dot((proj - transformed_element.vertices[vertex_idx]) -
+                           chord_center) > Scalar{0};
+
+      if (invert_segment_area) {
+        segment_area = intersection_radius_sq[face_idx] * pi - segment_area;
+      }
+
+      result[face_idx + 1] += triangle_area + segment_area;
+
+      // sanity checks: detect excessively large intermediate result
+      overlap_assert(result[face_idx + 1] <
+                         face_area(transformed_element, face_idx) +
+                             std::sqrt(detail::large_epsilon),
+                     "invalid intermediate result in overlap_area()");
+    }
+  }
+
+  return result;
+}
+
+// Scale the areas calculated by unit_overlap_area() back for the original
+// sphere, clamp them within reasonable limits and sum up the face areas.
+template<typename Element>
+void scale_overlap_area(const Sphere& sphere,
+                        const Element& transformed_element,
+                        std::array<Scalar, num_faces<Element>() + 2>& result) {
+  const auto unit_sphere = Sphere{};
+
+  const auto scaling = sphere.radius;
+  const auto sphere_limit = std::sqrt(std::numeric_limits<Scalar>::epsilon()) *
+                            unit_sphere.surface_area();
+
+  // as the precision of the area calculation deteriorates quickly with a
+  // increasing size ratio between the element and the sphere, the precision
+  // limit applied to the sphere is used as the lower limit for the facets
+  const auto face_limit =
+      std::max(sphere_limit, std::sqrt(std::numeric_limits<Scalar>::epsilon()) *
+                                 transformed_element.surface_area());
+
+  // sanity checks: detect negative/excessively large results for the surface
+  // area of the facets
+  for (auto face_idx = 0u; face_idx < num_faces<Element>(); ++face_idx) {
+    overlap_assert(result[face_idx + 1] > -face_limit,
+                   "negative overlap area for face in overlap_area()");
+
+    overlap_assert(result[face_idx + 1] <=
+                       face_area(transformed_element, face_idx) + face_limit,
+                   "invalid overlap area for face in overlap_area()");
+  }
+
+  // surface of the sphere within the element
+  result[0] = (scaling * scaling) * detail::clamp(result[0], Scalar{0},
+                                                  unit_sphere.surface_area(),
+                                                  sphere_limit);
+
+  // surfaces of the mesh element within the sphere
+  for (auto face_idx = 0u; face_idx < num_faces<Element>(); ++face_idx) {
+    result[face_idx + 1] =
+        (scaling * scaling) *
+        detail::clamp(result[face_idx + 1], Scalar{0},
+                      face_area(transformed_element, face_idx), face_limit);
+  }
+
+  result.back() =
+      std::accumulate(result.begin() + 1, result.end() - 1, Scalar{0});
+}
+
+// Area, first moment and polar second moment of a region in the plane, see
+// disk_polygon_moments().
+struct DiskMoments {
+  Scalar area = Scalar{0};
+  Vector2 first = Vector2::Zero();
+  Scalar polar = Scalar{0};
+};
+
+// z-component of the cross product of two vectors in the plane
+inline auto cross2(const Vector2& a, const Vector2& b) -> Scalar {
+  return a[0] * b[1] - a[1] * b[0];
+}
+
+// Walks the boundary of the intersection of a disk centered at the origin and
+// a convex polygon with counterclockwise vertices. The boundary consists of
+// the parts of the polygon edges inside the disk, passed as segment(a, b), and
+// of the counterclockwise arcs of the circle inside the polygon, passed as
+// arc(theta0, theta1).
+template<std::size_t N, typename Segment, typename Arc>
+void disk_polygon_boundary(const std::array<Vector2, N>& polygon,
+                           const Scalar radius, Segment&& segment, Arc&& arc) {
+  const auto inside_polygon = [&](const Vector2& p) {
+    for (auto idx = 0u; idx < N; ++idx) {
+      const auto& a = polygon[idx];
+      if (cross2(polygon[(idx + 1) % N] - a, p - a) < Scalar{0}) {
+        return false;
+      }
+    }
+
+    return true;
+  };
+
+  // angles of the points where the boundary of the polygon crosses the circle,
+  // unused entries are kept at infinity so the whole array can be sorted
+  auto angles = std::array<Scalar, 2 * N>{};
+  angles.fill(std::numeric_limits<Scalar>::infinity());
+  auto angle_count = 0u;
+
+  for (auto idx = 0u; idx < N; ++idx) {
+    const auto& a = polygon[idx];
+    const auto d = Vector2{polygon[(idx + 1) % N] - a};
+
+    // |a + t d| = radius
+    const auto dd = d.squaredNorm();
+    if (dd <= Scalar{0}) {
+      continue;
+    }
+
+    const auto p = a.dot(d) / dd;
+    const auto q = (a.squaredNorm() - radius * radius) / dd;
+    const auto discriminant = p * p - q;
+    if (discriminant <= Scalar{0}) {
+      continue;
+    }
+
+    const auto t0 = -p - std::sqrt(discriminant);
+    const auto t1 = -p + std::sqrt(discriminant);
+    if (std::max(t0, Scalar{0}) >= std::min(t1, Scalar{1})) {
+      continue;
+    }
+
+    const auto x0 = Vector2{a + std::max(t0, Scalar{0}) * d};
+    const auto x1 = Vector2{a + std::min(t1, Scalar{1}) * d};
+    segment(x0, x1);
+
+    if (t0 >= Scalar{0}) {
+      angles[angle_count++] = std::atan2(x0[1], x0[0]);
+    }
+
+    if (t1 <= Scalar{1}) {
+      angles[angle_count++] = std::atan2(x1[1], x1[0]);
+    }
+  }
+
+  if (angle_count == 0u) {
+    // the circle is either fully inside or fully outside of the polygon
+    if (inside_polygon(Vector2{radius, 0})) {
+      arc(Scalar{0}, Scalar{2} * pi);
+    }
+
+    return;
+  }
+
+  std::sort(angles.begin(), angles.end());
+  for (auto idx = 0u; idx < angle_count; ++idx) {
+    const auto theta0 = angles[idx];
+    const auto theta1 = idx + 1 < angle_count ? angles[idx + 1]
+                                              : angles[0] + Scalar{2} * pi;
+
+    // the arcs between the crossings are alternately inside and outside
+    const auto mid = Scalar{0.5} * (theta0 + theta1);
+    if (inside_polygon(radius * Vector2{std::cos(mid), std::sin(mid)})) {
+      arc(theta0, theta1);
+    }
+  }
+}
+
+// Area, first moment and polar second moment (w.r.t. the origin) of the
+// intersection of a disk centered at the origin and a convex polygon with
+// counterclockwise vertices. All are integrated along the boundary of the
+// intersection via Green's theorem, see disk_polygon_boundary().
+template<std::size_t N>
+auto disk_polygon_moments(const std::array<Vector2, N>& polygon,
+                          const Scalar radius) -> DiskMoments {
+  auto result = DiskMoments{};
+  auto& moment = result.first;
+
+  // sum of a^k b^(3-k), the integral of a cubic along the segment is given by
+  // a quarter of it
+  const auto cubic = [](const Scalar a, const Scalar b) {
+    return a * a * a + a * a * b + a * b * b + b * b * b;
+  };
+
+  // straight part of the boundary from a to b
+  const auto add_segment = [&](const Vector2& a, const Vector2& b) {
+    result.area += Scalar{0.5} * cross2(a, b);
+    moment[0] += (b[1] - a[1]) * (a[0] * a[0] + a[0] * b[0] + b[0] * b[0]) /
+                 Scalar{6};
+    moment[1] -= (b[0] - a[0]) * (a[1] * a[1] + a[1] * b[1] + b[1] * b[1]) /
+                 Scalar{6};
+    result.polar += ((b[1] - a[1]) * cubic(a[0], b[0]) -
+                     (b[0] - a[0]) * cubic(a[1], b[1])) /
+                    Scalar{12};
+  };
+
+  // counterclockwise arc of the circle between the two angles
+  const auto add_arc = [&](const Scalar theta0, const Scalar theta1) {
+    const auto r3 = radius * radius * radius;
+    const auto sin0 = std::sin(theta0);
+    const auto sin1 = std::sin(theta1);
+    const auto cos0 = std::cos(theta0);
+    const auto cos1 = std::cos(theta1);
+
+    result.area += Scalar{0.5} * radius * radius * (theta1 - theta0);
+    moment[0] += Scalar{0.5} * r3 *
+                 ((sin1 - sin1 * sin1 * sin1 / Scalar{3}) -
+                  (sin0 - sin0 * sin0 * sin0 / Scalar{3}));
+    moment[1] += Scalar{0.5} * r3 *
+                 ((cos1 * cos1 * cos1 / Scalar{3} - cos1) -
+                  (cos0 * cos0 * cos0 / Scalar{3} - cos0));
+    // cos^4 + sin^4 = 3 / 4 + cos(4 theta) / 4
+    result.polar += radius * r3 / Scalar{3} *
+                    (Scalar{0.75} * (theta1 - theta0) +
+                     (std::sin(Scalar{4} * theta1) -
+                      std::sin(Scalar{4} * theta0)) /
+                         Scalar{16});
+  };
+
+  disk_polygon_boundary(polygon, radius, add_segment, add_arc);
+
+  return result;
+}
+
+// Vertices of a planar polygon in 3D in an orthonormal basis of its plane,
+// centered at the projection of the center of the sphere onto the plane, and
+// the squared radius of the disk cut off by the plane. The basis is oriented
+// such that polygons counterclockwise w.r.t. the normal remain
+// counterclockwise.
+template<std::size_t N>
+auto disk_plane_projection(const Sphere& sphere,
+                           const std::array<Vector, N>& polygon,
+                           const Vector& normal)
+    -> std::pair<std::array<Vector2, N>, Scalar> {
+  const auto dist = normal.dot(polygon[0] - sphere.center);
+  const auto origin = Vector{sphere.center + dist * normal};
+  const auto u = Vector{(polygon[1] - polygon[0]).normalized()};
+  const auto w = Vector{normal.cross(u)};
+
+  auto points = std::array<Vector2, N>{};
+  for (auto idx = 0u; idx < N; ++idx) {
+    const auto rel = Vector{polygon[idx] - origin};
+    points[idx] = Vector2{rel.dot(u), rel.dot(w)};
+  }
+
+  return {points, sphere.radius * sphere.radius - dist * dist};
+}
+
+// Integrals of the linear shape functions of a triangle in 3D over its
+// intersection with a sphere, given the plane of the triangle.
+inline auto sphere_triangle_weights(const Sphere& sphere,
+                                    const std::array<Vector, 3>& triangle,
+                                    const Vector& normal)
+    -> std::array<Scalar, 3> {
+  auto weights = std::array<Scalar, 3>{};
+
+  const auto [points, radius_sq] = disk_plane_projection(sphere, triangle,
+                                                         normal);
+  if (radius_sq <= Scalar{0}) {
+    return weights;
+  }
+
+  const auto moments = disk_polygon_moments(points, std::sqrt(radius_sq));
+  const auto area = moments.area;
+  if (area <= Scalar{0}) {
+    return weights;
+  }
+
+  // the shape functions are linear, so their integrals follow from the values
+  // at the centroid of the intersection
+  const auto centroid = Vector2{moments.first / area};
+  const auto orient = [](const Vector2& a, const Vector2& b,
+                         const Vector2& c) {
+    return (b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]);
+  };
+
+  const auto total = orient(points[0], points[1], points[2]);
+  weights[0] = area * orient(centroid, points[1], points[2]) / total;
+  weights[1] = area * orient(points[0], centroid, points[2]) / total;
+  weights[2] = area * orient(points[0], points[1], centroid) / total;
+
+  return weights;
+}
+
+// Interval of times during which a sphere moving along the line
+// c(t) = c0 + v t, where c0 is the center of the given sphere, touches or
+// overlaps a convex element. The distance of the center from the element is
+// attained at a face, an edge or a vertex. Hence, the sphere enters the element
+// at the earliest time the distance from the plane of a face, the line of an
+// edge or a vertex decreases to the radius with the closest point within the
+// face or the edge, and it leaves the element at the latest time such a
+// distance increases to the radius.
+template<typename Element>
+auto contact_interval(const Sphere& sphere, const Vector& velocity,
+                      const Element& element)
+    -> std::optional<std::pair<Scalar, Scalar>> {
+  const auto radius_sq = sphere.radius * sphere.radius;
+
+  auto entry = std::numeric_limits<Scalar>::infinity();
+  auto exit = -std::numeric_limits<Scalar>::infinity();
+
+  // times at which |w0 + w1 t| equals the radius
+  const auto roots = [&](const Vector& w0, const Vector& w1)
+      -> std::optional<std::array<Scalar, 2>> {
+    const auto a = w1.squaredNorm();
+    if (a <= Scalar{0}) {
+      return std::nullopt;
+    }
+
+    const auto b = w0.dot(w1);
+    const auto discriminant = b * b - a * (w0.squaredNorm() - radius_sq);
+    if (discriminant < Scalar{0}) {
+      return std::nullopt;
+    }
+
+    const auto root = std::sqrt(discriminant);
+    return std::array<Scalar, 2>{(-b - root) / a, (-b + root) / a};
+  };
+
+  for (const auto& vertex : element.vertices) {
+    if (const auto t = roots(Vector{sphere.center - vertex}, velocity)) {
+      entry = std::min(entry, (*t)[0]);
+      exit = std::max(exit, (*t)[1]);
+    }
+  }
+
+  for (auto edge_idx = 0u; edge_idx < num_edges<Element>(); ++edge_idx) {
+    const auto& base = element.vertices[Element::edge_mapping[edge_idx][0][0]];
+    const auto edge = Vector{
+        element.vertices[Element::edge_mapping[edge_idx][0][1]] - base};
+    const auto length = edge.norm();
+    const auto direction = Vector{edge / length};
+
+    // components perpendicular to the edge
+    const auto w0 = Vector{sphere.center - base};
+    const auto w1 = Vector{velocity - velocity.dot(direction) * direction};
+    const auto t = roots(Vector{w0 - w0.dot(direction) * direction}, w1);
+    if (!t) {
+      continue;
+    }
+
+    const auto on_edge = [&](const Scalar time) {
+      const auto s = (w0 + time * velocity).dot(direction);
+      return s >= Scalar{0} && s <= length;
+    };
+
+    if (on_edge((*t)[0])) {
+      entry = std::min(entry, (*t)[0]);
+    }
+
+    if (on_edge((*t)[1])) {
+      exit = std::max(exit, (*t)[1]);
+    }
+  }
+
+  for (auto face_idx = 0u; face_idx < num_faces<Element>(); ++face_idx) {
+    const auto& face = element.faces[face_idx];
+    const auto speed = face.normal.dot(velocity);
+    if (speed == Scalar{0}) {
+      continue;
+    }
+
+    // the center is at the distance of the radius in front of the face
+    const auto t =
+        (sphere.radius - face.normal.dot(sphere.center - face.center)) / speed;
+
+    const auto& mapping = Element::face_vertex_mapping[face_idx];
+    if (!contains_projection(
+            Element::face_vertex_count[face_idx],
+            [&](const std::size_t idx) -> const Vector& {
+              return element.vertices[mapping[idx]];
+            },
+            face.center, face.normal, Vector{sphere.center + t * velocity})) {
+      continue;
+    }
+
+    if (speed < Scalar{0}) {
+      entry = std::min(entry, t);
+    } else {
+      exit = std::max(exit, t);
+    }
+  }
+
+  if (entry > exit) {
+    return std::nullopt;
+  }
 
-  const auto unit_sphere = Sphere{};
+  return std::make_pair(entry, exit);
+}
 
-  if (distances[1].second < distances[2].second * detail::large_epsilon) {
-    // Use the general spherical wedge defined by the edge with the
-    // non-degenerated intersection point and the normals of the
-    // two faces forming it.
-    return general_wedge<Dim, Element>(
-        unit_sphere, element,
-        Element::vertex_mapping[vertex_idx][0][distances[2].first],
-        edge_intersections);
+// Volume of the intersection of two spheres, given by the sum of the two caps
+// cut off by the plane of the intersection circle.
+inline auto intersection_volume(const Sphere& s0, const Sphere& s1) -> Scalar {
+  const auto dist = (s1.center - s0.center).norm();
+  if (dist >= s0.radius + s1.radius) {
+    return Scalar{0};
   }
 
-  // Make sure the normal points in the right direction i.e. away from
-  // the center of the element.
-  if (cone_triangle.normal.dot(element.center - cone_triangle.center) >
-      Scalar{0}) {
-    cone_triangle.normal = -cone_triangle.normal;
+  if (dist <= std::abs(s0.radius - s1.radius)) {
+    return std::min(s0.volume, s1.volume);
   }
 
-  // Calculate the volume/surface area of the three spherical segments between
-  // the faces joining at the vertex and the plane through the intersection
-  // points.
-  auto segment_correction = [&]() {
-    const auto plane = Plane{cone_triangle.center, cone_triangle.normal};
-    const auto local_face_indices = {0u, 1u, 2u};
-    return std::accumulate(
-        std::begin(local_face_indices), std::end(local_face_indices), Scalar{0},
-        [&](const Scalar initial, const auto local_face_idx) {
-          const auto& face =
-              element.faces[Element::vertex_mapping[vertex_idx][2]
-                                                   [local_face_idx]];
+  // distance of the plane of the intersection circle from the center of s0
+  const auto x = (dist * dist + s0.radius * s0.radius - s1.radius * s1.radius) /
+                 (Scalar{2} * dist);
 
-          const auto center =
-              (Scalar{0.5} *
-               (intersection_points[Element::face_mapping[local_face_idx][0]] +
-                intersection_points[Element::face_mapping[local_face_idx][1]]))
-                  .eval();
+  return s0.cap_volume(s0.radius - x) + s1.cap_volume(s1.radius - (dist - x));
+}
 
-          return initial + general_wedge<Dim>(unit_sphere, plane,
-                                              Plane{face.center, -face.normal},
-                                              center);
-        });
+// Assign the volumes of all cells of the subtree rooted at the given node,
+// which is fully contained in the sphere, without any further tests.
+inline auto assign_contained(const Octree& octree, const std::size_t node_idx,
+                             OctreeOverlap& result,
+                             OctreeStatistics* statistics) -> Scalar {
+  const auto& node = octree.node(node_idx);
+
+  auto volume = node.box.volume();
+  if (octree.is_leaf(node_idx)) {
+    result.level_volumes[node.level] += volume;
+
+    if (statistics != nullptr) {
+      ++statistics->contained_leaves;
+    }
+  } else {
+    volume = Scalar{0};
+    for (auto child = 0u; child < 8u; ++child) {
+      volume += assign_contained(octree, node.first_child + child, result,
+                                 statistics);
+    }
+  }
+
+  result.volumes[node_idx] = volume;
+
+  return volume;
+}
+
+// Descend the octree, skipping subtrees disjoint from the sphere and
+// assigning the volumes of subtrees fully contained in it. Only the leaves cut
+// by the surface of the sphere require the exact calculation.
+inline auto octree_overlap(const Sphere& sphere, const Octree& octree,
+                           const std::size_t node_idx, OctreeOverlap& result,
+                           OctreeStatistics* statistics) -> Scalar {
+  const auto& node = octree.node(node_idx);
+  const auto radius_sq = sphere.radius * sphere.radius;
+
+  if (statistics != nullptr) {
+    ++statistics->visited_nodes;
+  }
+
+  if (!(node.box.squaredExteriorDistance(sphere.center) < radius_sq)) {
+    return Scalar{0};
+  }
+
+  // distance of the corner farthest away from the center of the sphere
+  const auto far_corner = Vector{
+      (sphere.center - node.box.min())
+          .cwiseAbs()
+          .cwiseMax((node.box.max() - sphere.center).cwiseAbs())};
+  if (far_corner.squaredNorm() <= radius_sq) {
+    return assign_contained(octree, node_idx, result, statistics);
+  }
+
+  auto volume = Scalar{0};
+  if (octree.is_leaf(node_idx)) {
+    // the cell is known to be cut by the surface of the sphere
+    volume = validated_overlap_volume(sphere, octree.cell(node_idx));
+    result.level_volumes[node.level] += volume;
+
+    if (statistics != nullptr) {
+      ++statistics->exact_leaves;
+    }
+  } else {
+    for (auto child = 0u; child < 8u; ++child) {
+      volume += octree_overlap(sphere, octree, node.first_child + child,
+                               result, statistics);
+    }
+  }
+
+  result.volumes[node_idx] = volume;
+
+  return volume;
+}
+
+}  // namespace detail
+
+// expose types required for public API
+using Vector = detail::Vector;
+using Scalar = detail::Scalar;
+
+using OverlapStatus = detail::OverlapStatus;
+using OverlapVolumes = detail::OverlapVolumes;
+using OverlapEstimate = detail::OverlapEstimate;
+using OverlapBounds = detail::OverlapBounds;
+using OctreeOverlap = detail::OctreeOverlap;
+using OctreeStatistics = detail::OctreeStatistics;
+using OverlapGradient = detail::OverlapGradient;
+using OverlapMoments = detail::OverlapMoments;
+using FallbackStatistics = detail::FallbackStatistics;
+using BoundsStatistics = detail::BoundsStatistics;
+using PipelineStatistics = detail::PipelineStatistics;
+using SphereElementPair = detail::SphereElementPair;
+
+using Transformation = detail::Transformation;
+using PolygonBase = detail::PolygonBase;
+using Triangle = detail::Triangle;
+using Quadrilateral = detail::Quadrilateral;
+
+using Sphere = detail::Sphere;
+using Tetrahedron = detail::Tetrahedron;
+using Wedge = detail::Wedge;
+using Hexahedron = detail::Hexahedron;
+using Pyramid = detail::Pyramid;
+
+template<typename Element>
+using CompactElement = detail::CompactElement<Element>;
+
+using CompactTetrahedron = detail::CompactTetrahedron;
+using CompactWedge = detail::CompactWedge;
+using CompactHexahedron = detail::CompactHexahedron;
+using CompactPyramid = detail::CompactPyramid;
+
+template<typename Element, typename Index = std::uint32_t>
+using ElementView = detail::ElementView<Element, Index>;
+
+template<typename Element, typename Index = std::uint32_t>
+using IndexedMesh = detail::IndexedMesh<Element, Index>;
+
+template<typename... Elements>
+using HybridMesh = detail::HybridMesh<Elements...>;
+
+template<typename Element>
+using PrescaledElement = detail::PrescaledElement<Element>;
+
+using ConvexPolyhedron = detail::ConvexPolyhedron;
+using Octree = detail::Octree;
+
+template<typename Element>
+auto overlap_volume(const Sphere& sphere, const Element& element) -> Scalar {
+  using namespace detail;
+
+  static_assert(is_element_v<Element>, "invalid element type detected");
+
+  if (!intersects_coarse(sphere, element)) {
+    return Scalar{0};
+  }
+
+  // check for trivial case: element fully contained in sphere
+  if (contains(sphere, element)) {
+    return element.volume;
+  }
+
+  return exact_overlap_volume(sphere, element);
+}
+
+// Check the element for use with overlap_volume_unchecked(), which relies on
+// all faces of the element being planar.
+template<typename Element>
+auto validate(const Element& element) noexcept -> OverlapStatus {
+  static_assert(detail::is_element_v<Element>,
+                "invalid element type detected");
+
+  return detail::has_planar_faces(element) ? OverlapStatus::success
+                                           : OverlapStatus::non_planar_face;
+}
+
+// Variant of overlap_volume() for elements already checked via validate(),
+// skipping the validation. No exception is raised due to non-planar faces,
+// see validated_overlap_volume().
+template<typename Element>
+auto overlap_volume_unchecked(const Sphere& sphere, const Element& element)
+    -> Scalar {
+  using namespace detail;
+
+  static_assert(is_element_v<Element>, "invalid element type detected");
+
+  if (!intersects_coarse(sphere, element)) {
+    return Scalar{0};
+  }
+
+  if (contains(sphere, element)) {
+    return element.volume;
+  }
+
+  return validated_overlap_volume(sphere, element);
+}
+
+// Variant of overlap_volume() returning no value instead of throwing if the
+// element has non-planar faces. As for overlap_volume(), elements disjoint
+// from or fully contained in the sphere are resolved without validation.
+template<typename Element>
+auto try_overlap_volume(const Sphere& sphere, const Element& element)
+    -> std::optional<Scalar> {
+  if (!detail::intersects_coarse(sphere, element)) {
+    return Scalar{0};
+  }
+
+  if (detail::contains(sphere, element)) {
+    return element.volume;
+  }
+
+  if (validate(element) != OverlapStatus::success) {
+    return std::nullopt;
+  }
+
+  return overlap_volume_unchecked(sphere, element);
+}
+
+// Containers of precomputed overlap volumes, placed after
+// overlap_volume_unchecked() used to fill them.
+namespace detail {
+
+// Cache of overlap volumes for the cells of a structured lattice, i.e.,
+// translated copies of a single reference element. The overlap volume only
+// depends on the position of the sphere relative to the cell and its radius,
+// which are rounded to multiples of the tolerance and used as the key of the
+// cache. All results refer to the rounded sphere, so the position and the
+// radius are exact up to half the tolerance in each component, independent of
+// the order of the queries.
+template<typename Element>
+class LatticeCache {
+  static_assert(is_element_v<Element>, "invalid element type detected");
+
+ public:
+  LatticeCache(const Element& element, const Scalar tolerance) :
+      element_{element}, tolerance_{tolerance} {
+    if (!(tolerance > Scalar{0})) {
+      throw std::invalid_argument{"invalid tolerance for lattice cache"};
+    }
+
+    // the faces are checked once instead of for every sphere
+    detect_non_planar_faces(element);
+  }
+
+  // Overlap volume of the sphere and the reference element translated by the
+  // given offset, e.g., the origin of a cell of the lattice.
+  auto volume(const Sphere& sphere, const Vector& translation) -> Scalar {
+    const auto offset = Vector{(sphere.center - translation) / tolerance_};
+    const auto key = Key{std::llround(offset[0]), std::llround(offset[1]),
+                         std::llround(offset[2]),
+                         std::llround(sphere.radius / tolerance_)};
+
+    if (const auto it = cache_.find(key); it != cache_.end()) {
+      ++hits_;
+      return it->second;
+    }
+
+    ++misses_;
+
+    const auto rounded = Sphere{
+        tolerance_ * Vector{Scalar(key[0]), Scalar(key[1]), Scalar(key[2])},
+        tolerance_ * Scalar(key[3])};
+    const auto result = rounded.radius > Scalar{0}
+                            ? overlap_volume_unchecked(rounded, element_)
+                            : Scalar{0};
+    cache_.emplace(key, result);
+
+    return result;
+  }
+
+  [[nodiscard]] auto element() const -> const Element& { return element_; }
+  [[nodiscard]] auto tolerance() const -> Scalar { return tolerance_; }
+
+  [[nodiscard]] auto size() const -> std::size_t { return cache_.size(); }
+  [[nodiscard]] auto hits() const -> std::size_t { return hits_; }
+  [[nodiscard]] auto misses() const -> std::size_t { return misses_; }
+
+  void clear() {
+    cache_.clear();
+    hits_ = 0;
+    misses_ = 0;
+  }
+
+ private:
+  using Key = std::array<long long, 4>;
+
+  struct KeyHash {
+    auto operator()(const Key& key) const noexcept -> std::size_t {
+      // combination of the components following boost::hash_combine()
+      auto result = std::size_t{0};
+      for (const auto component : key) {
+        result ^= std::hash<long long>{}(component) + 0x9e3779b97f4a7c15U +
+                  (result << 6U) + (result >> 2U);
+      }
+
+      return result;
+    }
   };
 
-  const auto dist = cone_triangle.normal.dot(-cone_triangle.center);
+  Element element_;
+  Scalar tolerance_;
+  std::unordered_map<Key, Scalar, KeyHash> cache_;
+  std::size_t hits_ = 0;
+  std::size_t misses_ = 0;
+};
 
-  if constexpr (Dim == 2) {
-    const auto cap_surface =
-        unit_sphere.cap_surface_area(unit_sphere.radius + dist);
+// Table of overlap volumes of a sphere of fixed radius and an element for the
+// centers of the sphere on a regular grid covering the bounding box of the
+// element extended by the radius. Outside of this box, the overlap volume
+// vanishes. Within the box, the volume is interpolated trilinearly. The
+// gradient of the overlap volume w.r.t. the center of the sphere is bounded by
+// the area of a great circle, pi r^2, so the interpolation error is bounded by
+// pi r^2 |h| / 2 with h being the spacing of the grid, see error_bound().
+template<typename Element>
+class OverlapVolumeTable {
+  static_assert(is_element_v<Element>, "invalid element type detected");
 
-    // If cap surface area is small, the corrections will be even smaller. There
-    // is no way to actually calculate them with reasonable precision, so they
-    // are just ignored.
-    if (cap_surface < large_epsilon) {
+ public:
+  OverlapVolumeTable(const Element& element, const Scalar radius,
+                     const std::size_t resolution) :
+      radius_{radius}, resolution_{resolution} {
+    if (!(radius > Scalar{0})) {
+      throw std::invalid_argument{"invalid radius for overlap volume table"};
+    }
+
+    if (resolution < 2) {
+      throw std::invalid_argument{
+          "invalid resolution for overlap volume table"};
+    }
+
+    detect_non_planar_faces(element);
+
+    auto aabb = Eigen::AlignedBox<Scalar, 3>{};
+    for (const auto& v : element.vertices) {
+      aabb.extend(v);
+    }
+
+    origin_ = Vector{aabb.min() - Vector::Constant(radius)};
+    spacing_ = Vector{(aabb.sizes() + Vector::Constant(Scalar{2} * radius)) /
+                      Scalar(resolution - 1)};
+
+    values_.resize(resolution * resolution * resolution);
+    for (auto k = 0u; k < resolution; ++k) {
+      for (auto j = 0u; j < resolution; ++j) {
+        for (auto i = 0u; i < resolution; ++i) {
+          const auto center = Vector{
+              origin_ + spacing_.cwiseProduct(Vector{Scalar(i), Scalar(j),
+                                                     Scalar(k)})};
+          values_[index(i, j, k)] =
+              overlap_volume_unchecked(Sphere{center, radius}, element);
+        }
+      }
+    }
+  }
+
+  // Interpolated overlap volume of the sphere centered at the given position
+  // and the element translated by the given offset.
+  [[nodiscard]] auto volume(const Vector& center,
+                            const Vector& translation = Vector::Zero()) const
+      -> Scalar {
+    const auto position =
+        Vector{(center - translation - origin_).cwiseQuotient(spacing_)};
+
+    const auto max_position = Scalar(resolution_ - 1);
+    if ((position.array() < Scalar{0}).any() ||
+        (position.array() > max_position).any()) {
       return Scalar{0};
     }
 
-    // Calculate the surface area of the cone and clamp it to zero.
-    return std::max(cap_surface - segment_correction(), Scalar{0});
-  } else if constexpr (Dim == 3) {
-    const auto tip_tet_volume =
-        (Scalar{1} / Scalar{6}) *
-        std::abs(-relative_intersection_points[2].dot(
-            (relative_intersection_points[0] - relative_intersection_points[2])
-                .cross(relative_intersection_points[1] -
-                       relative_intersection_points[2])));
+    auto cell = std::array<std::size_t, 3>{};
+    auto weight = Vector{};
+    for (auto dim = 0; dim < 3; ++dim) {
+      cell[dim] = std::min(static_cast<std::size_t>(position[dim]),
+                           resolution_ - 2);
+      weight[dim] = position[dim] - Scalar(cell[dim]);
+    }
+
+    auto result = Scalar{0};
+    for (auto corner = 0u; corner < 8u; ++corner) {
+      auto factor = Scalar{1};
+      auto node = cell;
+      for (auto dim = 0u; dim < 3u; ++dim) {
+        const auto upper = ((corner >> dim) & 1U) != 0U;
+        factor *= upper ? weight[dim] : Scalar{1} - weight[dim];
+        node[dim] += upper ? 1u : 0u;
+      }
+
+      result += factor * values_[index(node[0], node[1], node[2])];
+    }
+
+    return result;
+  }
+
+  // bound of the absolute interpolation error
+  [[nodiscard]] auto error_bound() const -> Scalar {
+    return Scalar{0.5} * pi * radius_ * radius_ * spacing_.norm();
+  }
+
+  [[nodiscard]] auto radius() const -> Scalar { return radius_; }
+  [[nodiscard]] auto resolution() const -> std::size_t { return resolution_; }
+  [[nodiscard]] auto origin() const -> const Vector& { return origin_; }
+  [[nodiscard]] auto spacing() const -> const Vector& { return spacing_; }
+
+ private:
+  [[nodiscard]] auto index(const std::size_t i, const std::size_t j,
+                           const std::size_t k) const -> std::size_t {
+    return (k * resolution_ + j) * resolution_ + i;
+  }
+
+  Scalar radius_;
+  std::size_t resolution_;
+  Vector origin_ = Vector::Zero();
+  Vector spacing_ = Vector::Zero();
+  std::vector<Scalar> values_;
+};
+
+}  // namespace detail
+
+template<typename Element>
+using LatticeCache = detail::LatticeCache<Element>;
+
+template<typename Element>
+using OverlapVolumeTable = detail::OverlapVolumeTable<Element>;
+
+template<typename Iterator>
+auto overlap_volume(const Sphere& s, Iterator first, Iterator last) -> Scalar {
+  static_assert(
+      detail::is_element_v<typename std::iterator_traits<Iterator>::value_type>,
+      "invalid element type detected");
+
+  return std::accumulate(first, last, Scalar{0},
+                         [&s](const Scalar partial, const auto& element) {
+                           return partial + overlap_volume(s, element);
+                         });
+}
+
+// Elements of indexed meshes are only instantiated if the coarse test does not
+// already rule out an intersection.
+template<typename Element, typename Index>
+auto overlap_volume(const Sphere& sphere,
+                    const ElementView<Element, Index>& view) -> Scalar {
+  if (!detail::intersects_coarse(sphere, view)) {
+    return Scalar{0};
+  }
+
+  return overlap_volume(sphere, view.compact());
+}
+
+// Overlap volume of a sphere and a convex polyhedron with arbitrary topology.
+inline auto overlap_volume(const Sphere& sphere,
+                           const ConvexPolyhedron& polyhedron) -> Scalar {
+  if (!detail::intersects_coarse(sphere, polyhedron)) {
+    return Scalar{0};
+  }
+
+  if (detail::contains(sphere, polyhedron)) {
+    return polyhedron.volume;
+  }
+
+  return detail::exact_overlap_volume(sphere, polyhedron);
+}
+
+// Calculate the overlap volume of a sphere and an element prescaled for the
+// radius of the sphere. Only the translation of the element is performed per
+// sphere.
+template<typename Element>
+auto overlap_volume(const Sphere& sphere,
+                    const PrescaledElement<Element>& element) -> Scalar {
+  using namespace detail;
+
+  overlap_assert(sphere.radius == element.radius(),
+                 "sphere radius differs from radius used for prescaling");
+
+  // sphere of radius one in the coordinate system of the scaled element
+  const auto scaled_sphere =
+      Sphere{Vector{sphere.center / sphere.radius}, Scalar{1}};
+
+  const auto& scaled = element.scaled();
+  if (!intersects_coarse(scaled_sphere, scaled)) {
+    return Scalar{0};
+  }
+
+  if (contains(scaled_sphere, scaled)) {
+    return element.volume();
+  }
+
+  // the apex of a pyramid clearly inside the sphere requires the decomposition
+  if constexpr (is_pyramid_v<Element>) {
+    if ((scaled.vertices[Element::apex] - scaled_sphere.center).squaredNorm() <
+        Scalar{1} - large_epsilon) {
+      return (decomposed_overlap_volume(scaled_sphere, scaled) /
+              scaled_sphere.volume) *
+             sphere.volume;
+    }
+  }
+
+  // only the vertices and face centers are translated, the prescaled element
+  // itself is not copied
+  const auto transformed_element = detail::CompactElement<Element>{
+      scaled, Transformation{-scaled_sphere.center, Scalar{1}}};
+
+  return (normalized_overlap_volume(transformed_element) /
+          scaled_sphere.volume) *
+         sphere.volume;
+}
+
+// Calculate the overlap volumes of a batch of sphere/element pairs, where the
+// pairs are processed in buckets of spheres of identical radius. Each element
+// is prescaled once per bucket it is used in, so systems with only a few
+// distinct radii avoid the scaling of the elements for every pair.
+template<typename Element>
+auto overlap_volume_pairs_bucketed(const std::vector<Sphere>& spheres,
+                                   const std::vector<Element>& elements,
+                                   const std::vector<SphereElementPair>& pairs)
+    -> std::vector<Scalar> {
+  auto order = std::vector<std::size_t>(pairs.size());
+  std::iota(std::begin(order), std::end(order), std::size_t{0});
+  std::stable_sort(std::begin(order), std::end(order),
+                   [&](const std::size_t a, const std::size_t b) {
+                     return spheres[pairs[a].first].radius <
+                            spheres[pairs[b].first].radius;
+                   });
+
+  auto results = std::vector<Scalar>(pairs.size(), Scalar{0});
+  auto scaled =
+      std::vector<std::optional<PrescaledElement<Element>>>(elements.size());
+
+  for (const auto pair_idx : order) {
+    const auto& [sphere_idx, element_idx] = pairs[pair_idx];
+    const auto& sphere = spheres[sphere_idx];
+
+    auto& element = scaled[element_idx];
+    if (!element.has_value() || element->radius() != sphere.radius) {
+      element.emplace(elements[element_idx], sphere.radius);
+    }
+
+    results[pair_idx] = overlap_volume(sphere, *element);
+  }
+
+  return results;
+}
+
+// Calculate the overlap volumes of a batch of sphere/element pairs, given as
+// pairs of indices into the sphere and element arrays. Instead of processing
+// each pair individually, the pairs are passed through separate stages: the
+// coarse intersection test, the containment tests and finally the exact
+// calculation, with the list of pairs compacted between the stages. This keeps
+// the control flow within each stage uniform. Optionally, the time spent in
+// each of the stages and the number of pairs reaching them is recorded.
+template<typename Element>
+auto overlap_volume_pairs(const std::vector<Sphere>& spheres,
+                          const std::vector<Element>& elements,
+                          const std::vector<SphereElementPair>& pairs,
+                          PipelineStatistics* statistics = nullptr)
+    -> std::vector<Scalar> {
+  static_assert(detail::is_element_v<Element>, "invalid element type detected");
+
+  using Clock = std::chrono::steady_clock;
+
+  auto results = std::vector<Scalar>(pairs.size(), Scalar{0});
+  auto survivors = std::vector<std::size_t>{};
+  auto remaining = std::vector<std::size_t>{};
+
+  survivors.reserve(pairs.size());
+  remaining.reserve(pairs.size());
+
+  const auto t0 = Clock::now();
+  detail::coarse_stage(spheres, elements, pairs, survivors);
+
+  const auto t1 = Clock::now();
+  detail::containment_stage(spheres, elements, pairs, survivors, results,
+                            remaining);
 
-    const auto cap_volume = unit_sphere.cap_volume(unit_sphere.radius + dist);
+  const auto t2 = Clock::now();
+  detail::exact_stage(spheres, elements, pairs, remaining, results);
 
-    // The cap volume is tiny, so the corrections will be even smaller. There is
-    // no way to actually calculate them with reasonable precision, so just the
-    // volume of the tetrahedron at the tip is used.
-    if (cap_volume < tiny_epsilon) {
-      return tip_tet_volume;
-    }
+  const auto t3 = Clock::now();
 
-    // Calculate the volume of the cone and clamp it to zero.
-    return std::max(tip_tet_volume + cap_volume - segment_correction(),
-                    Scalar{0});
+  if (statistics != nullptr) {
+    statistics->coarse_time += t1 - t0;
+    statistics->containment_time += t2 - t1;
+    statistics->exact_time += t3 - t2;
+
+    statistics->pairs += pairs.size();
+    statistics->coarse_survivors += survivors.size();
+    statistics->exact_pairs += remaining.size();
   }
 
-  return Scalar{};
+  return results;
 }
 
-template<typename Element>
-inline auto detect_non_planar_faces(const Element& element) -> void {
-  for (const auto& face : element.faces) {
-    if (!face.is_planar()) {
-      throw std::invalid_argument{"non-planer face detected in element"};
+// Calculate the overlap volumes of a sphere and all elements of a hybrid mesh.
+// The elements are processed in batches of the same type, with the results
+// stored in the order the elements were added to the mesh.
+template<typename... Elements>
+auto overlap_volumes(const Sphere& sphere, const HybridMesh<Elements...>& mesh)
+    -> std::vector<Scalar> {
+  auto results = std::vector<Scalar>(mesh.size(), Scalar{0});
+
+  mesh.for_each_batch([&](const auto& batch) {
+    for (auto idx = std::size_t{0}; idx < batch.elements.size(); ++idx) {
+      results[batch.indices[idx]] = overlap_volume(sphere, batch.elements[idx]);
     }
+  });
+
+  return results;
+}
+
+// Calculate the overlap volumes of a sphere and all cells of an octree. The
+// hierarchy is descended using cheap box tests: subtrees disjoint from the
+// sphere are skipped and subtrees fully contained in it are assigned the
+// volumes of their cells. Only the leaves cut by the surface of the sphere are
+// evaluated exactly. Optionally, the number of visited nodes as well as of
+// contained and exactly evaluated leaves is recorded.
+inline auto overlap_volumes(const Sphere& sphere, const Octree& octree,
+                            OctreeStatistics* statistics = nullptr)
+    -> OctreeOverlap {
+  auto result = OctreeOverlap{std::vector<Scalar>(octree.size(), Scalar{0}),
+                              std::vector<Scalar>(octree.depth(), Scalar{0})};
+
+  if (statistics != nullptr) {
+    ++statistics->queries;
   }
+
+  detail::octree_overlap(sphere, octree, 0, result, statistics);
+
+  return result;
 }
 
-// normalize the element w.r.t the unit sphere
+// Calculate the overlap volumes of a batch of sphere/element pairs without
+// raising exceptions for invalid elements. Each element is validated once,
+// invalid elements are reported instead of aborting the whole batch.
 template<typename Element>
-inline auto normalize_element(const Sphere& sphere, const Element& element)
-    -> Element {
-  const auto transformation =
-      Transformation{-sphere.center, Scalar{1} / sphere.radius};
+auto try_overlap_volume_pairs(const std::vector<Sphere>& spheres,
+                              const std::vector<Element>& elements,
+                              const std::vector<SphereElementPair>& pairs)
+    -> OverlapVolumes {
+  auto valid = std::vector<std::uint8_t>(elements.size(), 0);
+  auto result = OverlapVolumes{std::vector<Scalar>(pairs.size(), Scalar{0}),
+                               std::vector<std::size_t>{}};
+
+  for (auto element_idx = std::size_t{0}; element_idx < elements.size();
+       ++element_idx) {
+    valid[element_idx] = validate(elements[element_idx]) ==
+                         OverlapStatus::success;
+
+    if (!valid[element_idx]) {
+      result.failed_elements.push_back(element_idx);
+    }
+  }
 
-  auto transformed_element = Element{element};
-  transformed_element.apply(transformation);
+  for (auto pair_idx = std::size_t{0}; pair_idx < pairs.size(); ++pair_idx) {
+    const auto [sphere_idx, element_idx] = pairs[pair_idx];
+    if (valid[element_idx]) {
+      result.volumes[pair_idx] = overlap_volume_unchecked(
+          spheres[sphere_idx], elements[element_idx]);
+    }
+  }
 
-  return transformed_element;
+  return result;
 }
 
-}  // namespace detail
+// Calculate the overlap volume of a sphere and a (possibly non-convex) body
+// bounded by a closed triangulated surface, given as a soup of triangles with
+// their vertices ordered counterclockwise when viewed from the outside. Every
+// triangle is connected to the reference point and the signed overlap volumes
+// of the resulting tetrahedra are summed up. The closer the reference point is
+// to the sphere, the more tetrahedra pass the coarse test. If compiled with
+// OpenMP support, the triangles are processed in parallel.
+inline auto overlap_volume_surface(
+    const Sphere& sphere, const std::vector<std::array<Vector, 3>>& triangles,
+    const Vector& reference) -> Scalar {
+  const auto count = static_cast<std::ptrdiff_t>(triangles.size());
+
+  auto volume = Scalar{0};
+
+#if defined(_OPENMP)
+#pragma omp parallel for reduction(+ : volume) schedule(dynamic, 64)
+#endif
+  for (std::ptrdiff_t idx = 0; idx < count; ++idx) {
+    volume += detail::signed_overlap_volume(
+        sphere, triangles[static_cast<std::size_t>(idx)], reference);
+  }
 
-// expose types required for public API
-using Vector = detail::Vector;
-using Scalar = detail::Scalar;
+  // the contributions of the individual tetrahedra cancel out, clamp the
+  // remaining rounding errors
+  return std::clamp(volume, Scalar{0}, sphere.volume);
+}
 
-using Sphere = detail::Sphere;
-using Tetrahedron = detail::Tetrahedron;
-using Wedge = detail::Wedge;
-using Hexahedron = detail::Hexahedron;
+// The center of the bounding box of the surface is used as reference point.
+inline auto overlap_volume_surface(
+    const Sphere& sphere, const std::vector<std::array<Vector, 3>>& triangles)
+    -> Scalar {
+  auto aabb = Eigen::AlignedBox<Scalar, 3>{};
+  for (const auto& triangle : triangles) {
+    for (const auto& v : triangle) {
+      aabb.extend(v);
+    }
+  }
+
+  return triangles.empty()
+             ? Scalar{0}
+             : overlap_volume_surface(sphere, triangles, aabb.center());
+}
 
+// Fast evaluation of the overlap volume using plain floating-point arithmetic
+// instead of the robust building blocks used by overlap_volume(). Besides the
+// volume, a first-order estimate of the absolute error is returned, obtained
+// by accumulating the condition numbers of the individual cap, wedge and cone
+// terms. This is a heuristic and not a rigorous bound of the error.
+// Configurations close to degeneracy result in a large or infinite error
+// estimate. The classification of the intersected vertices, edges and faces is
+// shared with overlap_volume(), but the faces of the element are assumed to be
+// planar without checking, see has_planar_faces().
 template<typename Element>
-auto overlap_volume(const Sphere& sphere, const Element& element) -> Scalar {
+auto overlap_volume_estimate(const Sphere& sphere, const Element& element)
+    -> OverlapEstimate {
   using namespace detail;
 
   static_assert(is_element_v<Element>, "invalid element type detected");
 
   if (!intersects_coarse(sphere, element)) {
-    return Scalar{0};
+    return OverlapEstimate{};
   }
 
   // check for trivial case: element fully contained in sphere
   if (contains(sphere, element)) {
-    return element.volume;
+    return OverlapEstimate{element.volume, Scalar{0}};
   }
 
-  // sanity check: all faces of the mesh element have to be planar
-  detect_non_planar_faces(element);
-
   // use unit sphere and transformed (scaled and shifted) version of the element
   const auto unit_sphere = Sphere{};
-  auto transformed_element = normalize_element(sphere, element);
+  const auto transformed_element = normalize_compact(sphere, element);
+  using Normalized = std::decay_t<decltype(transformed_element)>;
 
   const auto&& [entity_intersections, edge_intersections] =
       unit_sphere_intersections(transformed_element);
 
-  // trivial case: the center of the sphere overlaps the element, but the sphere
-  // does not intersect any of the faces of the element, meaning the sphere is
-  // completely contained within the element
+  // trivial case: sphere completely contained within the element
   if (!entity_intersections.faces.count() &&
       contains(transformed_element, unit_sphere.center)) {
-    return sphere.volume;
+    return OverlapEstimate{sphere.volume, Scalar{0}};
   }
 
-  // spurious intersection: The initial intersection test was positive, but the
-  // detailed checks revealed no overlap
+  // spurious intersection
   if (!entity_intersections.vertices.count() &&
       !entity_intersections.edges.count() &&
       !entity_intersections.faces.count()) {
-    return Scalar{0};
+    return OverlapEstimate{};
   }
 
-  // initial value: volume of the full sphere
+  // the apex of a pyramid requires the decomposition into two tetrahedra
+  if constexpr (is_pyramid_v<Element>) {
+    if (entity_intersections.vertices[Element::apex]) {
+      auto tets = std::array<Tetrahedron, 2>{};
+      decompose(element, tets);
+
+      auto estimate = OverlapEstimate{};
+      for (const auto& tet : tets) {
+        const auto partial = overlap_volume_estimate(sphere, tet);
+        estimate.volume += partial.volume;
+        estimate.error_estimate += partial.error_estimate;
+      }
+
+      return estimate;
+    }
+  }
+
+  // initial value: volume of the full sphere, which is known to full precision
   auto result = unit_sphere.volume;
+  auto condition = Scalar{1};
+  auto wedge_conditions = std::array<Scalar, num_edges<Element>()>{};
 
-  // iterate over all the marked faces and subtract the volume of the cap cut
-  // off by the plane
   for (auto face_idx = 0u; face_idx < num_faces<Element>(); ++face_idx) {
     if (!entity_intersections.faces[face_idx]) {
       continue;
@@ -1597,74 +5095,229 @@ auto overlap_volume(const Sphere& sphere, const Element& element) -> Scalar {
     const auto& face = transformed_element.faces[face_idx];
     const auto dist = face.normal.dot(-face.center);
 
+    // the derivative of the cap volume w.r.t. its height is bounded by pi
     result -= unit_sphere.cap_volume(unit_sphere.radius + dist);
+    condition += pi;
   }
 
-  // handle the edges and add back the volume subtracted twice above in the
-  // processing of the faces
   for (auto edge_idx = 0u; edge_idx < num_edges<Element>(); ++edge_idx) {
     if (!entity_intersections.edges[edge_idx]) {
       continue;
     }
 
-    result += general_wedge<3, Element>(unit_sphere, transformed_element,
-                                        edge_idx, edge_intersections);
+    result += general_wedge<3, Normalized, FastArithmetic>(
+        unit_sphere, transformed_element, edge_idx, edge_intersections);
+
+    wedge_conditions[edge_idx] =
+        wedge_condition(transformed_element, edge_idx, edge_intersections);
+    condition += wedge_conditions[edge_idx];
   }
 
-  // handle the vertices and subtract the volume added twice above in the
-  // processing of the edges
   for (auto vertex_idx = 0u; vertex_idx < num_vertices<Element>();
        ++vertex_idx) {
     if (!entity_intersections.vertices[vertex_idx]) {
       continue;
     }
 
-    result -= vertex_cone_correction<3>(transformed_element, edge_intersections,
-                                        vertex_idx);
+    result -= vertex_cone_correction<3, Normalized, FastArithmetic>(
+        transformed_element, edge_intersections, vertex_idx);
 
-    // sanity check: detect negative intermediate result
-    overlap_assert(result > -std::sqrt(detail::tiny_epsilon),
-                   "negative intermediate result in overlap_volume()");
+    condition += cone_condition<Normalized>(edge_intersections,
+                                            wedge_conditions, vertex_idx);
   }
 
-  // in case of different sized objects, the error can become quite large, so a
-  // relative limit is used
+  // each of the terms is evaluated using a few dozen floating-point operations
+  // including elementary functions, bounding the relative error of every term
+  static constexpr auto gamma =
+      Scalar{64} * std::numeric_limits<Scalar>::epsilon();
+
   const auto max_overlap_volume =
       std::min(unit_sphere.volume, transformed_element.volume);
 
-  const auto limit =
-      std::sqrt(std::numeric_limits<Scalar>::epsilon()) * max_overlap_volume;
+  result = std::clamp(result, Scalar{0}, max_overlap_volume);
 
-  // clamp tiny negative volumes to zero
-  if (result < Scalar{0} && result > -limit) {
-    return Scalar{0};
+  // scale the overlap volume and the error estimate back for the original
+  // objects
+  const auto scaling = sphere.volume / unit_sphere.volume;
+
+  return OverlapEstimate{result * scaling, (gamma * condition) * scaling};
+}
+
+// Calculate the overlap volume using the fast evaluation and fall back to the
+// robust overlap_volume() if the estimated error exceeds the given absolute
+// tolerance. As the error estimate is not rigorous, neither is the tolerance.
+// The faces of the element are assumed to be planar, see
+// overlap_volume_estimate(). Optionally, the number of evaluations and
+// fallbacks is recorded.
+template<typename Element>
+auto overlap_volume_adaptive(const Sphere& sphere, const Element& element,
+                             const Scalar tolerance,
+                             FallbackStatistics* statistics = nullptr)
+    -> Scalar {
+  overlap_assert(tolerance >= Scalar{0},
+                 "invalid tolerance for overlap_volume_adaptive()");
+
+  const auto estimate = overlap_volume_estimate(sphere, element);
+  const auto fallback = !(estimate.error_estimate <= tolerance);
+
+  if (statistics != nullptr) {
+    ++statistics->evaluations;
+    statistics->fallbacks += fallback ? 1u : 0u;
   }
 
-  // clamp results slightly too large
-  if (result > max_overlap_volume && result - max_overlap_volume < limit) {
-    return std::min(sphere.volume, element.volume);
+  return fallback ? overlap_volume(sphere, element) : estimate.volume;
+}
+
+// Guaranteed lower and upper bounds of the overlap volume, obtained without
+// evaluating the wedges and cones of the exact calculation. The overlap region
+// is contained in the sphere clipped by any single face plane, and the part of
+// the sphere outside of the element is covered by the caps beyond the face
+// planes. In addition, the element contains the sphere inscribed around its
+// center and is contained in the circumscribed one, so the intersection
+// volumes with these spheres bound the overlap volume as well. The (convex)
+// element is assumed to have planar faces.
+template<typename Element>
+auto overlap_volume_bounds(const Sphere& sphere, const Element& element)
+    -> OverlapBounds {
+  using namespace detail;
+
+  static_assert(is_element_v<Element>, "invalid element type detected");
+
+  if (!intersects_coarse(sphere, element)) {
+    return OverlapBounds{};
   }
 
-  // perform a final sanity check on the final result (debug version only)
-  overlap_assert(result >= Scalar{0} && result <= max_overlap_volume,
-                 "negative volume detected in overlap_volume()");
+  if (contains(sphere, element)) {
+    return OverlapBounds{element.volume, element.volume};
+  }
 
-  // scale the overlap volume back for the original objects
-  result = (result / unit_sphere.volume) * sphere.volume;
+  auto caps = Scalar{0};
+  auto max_cap = Scalar{0};
+  auto inner_radius = std::numeric_limits<Scalar>::infinity();
+  for (auto face_idx = 0u; face_idx < num_faces<Element>(); ++face_idx) {
+    const auto& face = element.faces[face_idx];
 
-  return result;
+    // cap of the sphere beyond the plane of the face
+    const auto cap = sphere.cap_volume(
+        sphere.radius + face.normal.dot(sphere.center - face.center));
+    caps += cap;
+    max_cap = std::max(max_cap, cap);
+
+    inner_radius =
+        std::min(inner_radius, face.normal.dot(face.center - element.center));
+  }
+
+  auto outer_radius_sq = Scalar{0};
+  for (const auto& vertex : element.vertices) {
+    outer_radius_sq =
+        std::max(outer_radius_sq, (vertex - element.center).squaredNorm());
+  }
+
+  const auto inscribed =
+      intersection_volume(sphere, Sphere{element.center, inner_radius});
+  const auto circumscribed = intersection_volume(
+      sphere, Sphere{element.center, std::sqrt(outer_radius_sq)});
+
+  // account for the rounding errors of the caps
+  const auto margin = Scalar(num_faces<Element>() + 1) * tiny_epsilon *
+                      sphere.volume;
+
+  const auto max_overlap_volume = std::min(sphere.volume, element.volume);
+  const auto lower = std::max(inscribed, sphere.volume - caps) - margin;
+  const auto upper = std::min(circumscribed, sphere.volume - max_cap) + margin;
+
+  return OverlapBounds{std::clamp(lower, Scalar{0}, max_overlap_volume),
+                       std::clamp(upper, Scalar{0}, max_overlap_volume)};
 }
 
+// Check whether the overlap volume exceeds the given threshold. The exact
+// overlap_volume() is only evaluated if the threshold lies within the bounds
+// provided by overlap_volume_bounds(). Optionally, the number of queries and
+// exact evaluations is recorded.
+template<typename Element>
+auto overlap_exceeds(const Sphere& sphere, const Element& element,
+                     const Scalar threshold,
+                     BoundsStatistics* statistics = nullptr) -> bool {
+  const auto bounds = overlap_volume_bounds(sphere, element);
+  const auto exact = bounds.lower <= threshold && threshold < bounds.upper;
+
+  if (statistics != nullptr) {
+    ++statistics->queries;
+    statistics->exact_evaluations += exact ? 1u : 0u;
+  }
+
+  if (!exact) {
+    return bounds.lower > threshold;
+  }
+
+  return overlap_volume(sphere, element) > threshold;
+}
+
+// Find the element of the range [first, last) with the largest overlap volume,
+// e.g., to assign a particle to its owner cell. Elements whose upper bound of
+// the overlap volume, see overlap_volume_bounds(), cannot beat the best lower
+// bound or the best exact volume found so far are pruned. The remaining
+// contenders are evaluated in the order of the distance of their centers from
+// the center of the sphere, so the closest elements raise the bar early on.
+// Returns the iterator to the element and its overlap volume, or last and zero
+// if no element overlaps with the sphere. Optionally, the number of candidates
+// and exact evaluations is recorded.
 template<typename Iterator>
-auto overlap_volume(const Sphere& s, Iterator first, Iterator last) -> Scalar {
+auto overlap_owner(const Sphere& sphere, Iterator first, Iterator last,
+                   BoundsStatistics* statistics = nullptr)
+    -> std::pair<Iterator, Scalar> {
   static_assert(
       detail::is_element_v<typename std::iterator_traits<Iterator>::value_type>,
       "invalid element type detected");
 
-  return std::accumulate(first, last, Scalar{0},
-                         [&s](const Scalar partial, const auto& element) {
-                           return partial + overlap_volume(s, element);
-                         });
+  struct Candidate {
+    Iterator element;
+    Scalar distance_sq;
+    OverlapBounds bounds;
+  };
+
+  auto candidates = std::vector<Candidate>{};
+  auto best_volume = Scalar{0};
+  for (auto it = first; it != last; ++it) {
+    const auto bounds = overlap_volume_bounds(sphere, *it);
+    if (statistics != nullptr) {
+      ++statistics->queries;
+    }
+
+    if (bounds.upper > Scalar{0}) {
+      candidates.push_back(
+          Candidate{it, (it->center - sphere.center).squaredNorm(), bounds});
+      best_volume = std::max(best_volume, bounds.lower);
+    }
+  }
+
+  std::sort(candidates.begin(), candidates.end(),
+            [](const Candidate& a, const Candidate& b) {
+              return a.distance_sq < b.distance_sq;
+            });
+
+  auto result = std::make_pair(last, Scalar{0});
+  for (const auto& candidate : candidates) {
+    if (candidate.bounds.upper < best_volume ||
+        candidate.bounds.upper <= result.second) {
+      continue;
+    }
+
+    auto volume = candidate.bounds.lower;
+    if (candidate.bounds.lower < candidate.bounds.upper) {
+      volume = overlap_volume(sphere, *candidate.element);
+      if (statistics != nullptr) {
+        ++statistics->exact_evaluations;
+      }
+    }
+
+    if (volume > result.second) {
+      result = std::make_pair(candidate.element, volume);
+      best_volume = std::max(best_volume, volume);
+    }
+  }
+
+  return result;
 }
 
 // Calculate the surface area of the sphere and the element that are contained
@@ -1692,8 +5345,8 @@ auto overlap_area(const Sphere& sphere, const Element& element)
   // full coverage of all faces
   if (contains(sphere, element)) {
     for (auto face_idx = 0u; face_idx < num_faces<Element>(); ++face_idx) {
-      result[face_idx + 1] = element.faces[face_idx].area;
-      result.back() += element.faces[face_idx].area;
+      result[face_idx + 1] = face_area(element, face_idx);
+      result.back() += result[face_idx + 1];
     }
 
     return result;
@@ -1719,270 +5372,591 @@ auto overlap_area(const Sphere& sphere, const Element& element)
     return result;
   }
 
-  // spurious intersection: ihe initial intersection test was positive, but the
-  // detailed checks revealed no overlap
-  if (!entity_intersections.vertices.count() &&
-      !entity_intersections.edges.count() &&
-      !entity_intersections.faces.count()) {
+  // spurious intersection: ihe initial intersection test was positive, but the
+  // detailed checks revealed no overlap
+  if (!entity_intersections.vertices.count() &&
+      !entity_intersections.edges.count() &&
+      !entity_intersections.faces.count()) {
+    return result;
+  }
+
+  // The apex of a pyramid requires the decomposition into two tetrahedra.
+  // These share the lateral faces of the pyramid, while the base is split
+  // between them.
+  if constexpr (is_pyramid_v<Element>) {
+    if (entity_intersections.vertices[Element::apex]) {
+      auto tets = std::array<Tetrahedron, 2>{};
+      decompose(element, tets);
+
+      const auto areas = std::array{overlap_area(sphere, tets[0]),
+                                    overlap_area(sphere, tets[1])};
+
+      result[0] = areas[0][0] + areas[1][0];
+      result[1] = areas[0][1] + areas[1][1];
+      result[2] = areas[0][2];
+      result[3] = areas[0][3];
+      result[4] = areas[1][3];
+      result[5] = areas[1][4];
+      result.back() =
+          std::accumulate(result.begin() + 1, result.end() - 1, Scalar{0});
+
+      return result;
+    }
+  }
+
+  result = unit_overlap_area(transformed_element, entity_intersections,
+                             edge_intersections);
+  scale_overlap_area(sphere, transformed_element, result);
+
+  // perform final sanity checks on the result (debug version only)
+  overlap_assert(Scalar{0} <= result[0] && result[0] <= sphere.surface_area(),
+                 "invalid overlap area for sphere surface in overlap_area()");
+
+  overlap_assert(
+      Scalar{0} <= result.back() && result.back() <= element.surface_area(),
+      "invalid total overlap area for faces in overlap_area()");
+
+  return result;
+}
+
+// Overlap volume of a sphere and an element together with its derivatives
+// w.r.t. the center and the radius of the sphere. The volume and the areas
+// determining the derivatives share the normalization of the element and the
+// detection of the intersections, and only the areas of the faces are
+// calculated explicitly.
+template<typename Element>
+auto overlap_volume_gradient(const Sphere& sphere, const Element& element)
+    -> OverlapGradient {
+  using namespace detail;
+
+  static_assert(is_element_v<Element>, "invalid element type detected");
+
+  auto result = OverlapGradient{};
+
+  if (!intersects_coarse(sphere, element)) {
+    return result;
+  }
+
+  // element fully contained in the sphere: small changes of the sphere do not
+  // affect the overlap
+  if (contains(sphere, element)) {
+    result.volume = element.volume;
+
+    return result;
+  }
+
+  // sanity check: all faces of the mesh element have to be planar
+  detect_non_planar_faces(element);
+
+  const auto unit_sphere = Sphere{};
+  const auto transformed_element = normalize_element(sphere, element);
+
+  const auto&& [entity_intersections, edge_intersections] =
+      unit_sphere_intersections(transformed_element);
+
+  // sphere fully contained in the element
+  if (!entity_intersections.faces.count() &&
+      contains(transformed_element, unit_sphere.center)) {
+    result.volume = sphere.volume;
+    result.radius = sphere.surface_area();
+
+    return result;
+  }
+
+  // spurious intersection: no overlap
+  if (!entity_intersections.vertices.count() &&
+      !entity_intersections.edges.count() &&
+      !entity_intersections.faces.count()) {
+    return result;
+  }
+
+  const auto normalized_volume = normalized_overlap_volume(
+      transformed_element, entity_intersections, edge_intersections);
+
+  result.volume = (normalized_volume / unit_sphere.volume) * sphere.volume;
+
+  // the apex of a pyramid requires the decomposition into two tetrahedra
+  if constexpr (is_pyramid_v<Element>) {
+    if (entity_intersections.vertices[Element::apex]) {
+      gradient_from_areas(element, overlap_area(sphere, element), result);
+
+      return result;
+    }
+  }
+
+  auto areas = unit_overlap_area<false>(transformed_element,
+                                        entity_intersections,
+                                        edge_intersections);
+
+  // Instead of the wedge and cone terms, the surface area of the sphere inside
+  // the element follows from the divergence theorem applied to the position
+  // relative to the center of the sphere over the overlap region:
+  // 3 V = r A_sphere + sum_f h_f A_f, where h_f is the distance of face f from
+  // the center. For the unit sphere, the radius is 1.
+  auto sphere_area = Scalar{3} * normalized_volume;
+  for (auto face_idx = 0u; face_idx < num_faces<Element>(); ++face_idx) {
+    const auto& face = transformed_element.faces[face_idx];
+    sphere_area -= face.normal.dot(face.center) * areas[face_idx + 1];
+  }
+
+  areas[0] = std::clamp(sphere_area, Scalar{0}, unit_sphere.surface_area());
+  scale_overlap_area(sphere, transformed_element, areas);
+
+  gradient_from_areas(element, areas, result);
+
+  return result;
+}
+
+// Derivatives of the overlap volume of a sphere and an element w.r.t. the
+// positions of the vertices of the element. Displacing the points of a face
+// changes the volume at the rate of the normal displacement integrated over
+// the part of the face inside the sphere. The displacements within a triangular
+// face are interpolated linearly from its vertices. Quadrilateral faces are
+// split into four triangles around the face center, which moves with the mean
+// displacement of the vertices.
+template<typename Element>
+auto overlap_volume_vertex_gradient(const Sphere& sphere,
+                                    const Element& element)
+    -> std::array<Vector, detail::num_vertices<Element>()> {
+  using namespace detail;
+
+  static_assert(is_element_v<Element>, "invalid element type detected");
+
+  auto result = std::array<Vector, num_vertices<Element>()>{};
+  std::fill(result.begin(), result.end(), Vector::Zero());
+
+  if (!intersects_coarse(sphere, element)) {
+    return result;
+  }
+
+  // sanity check: all faces of the mesh element have to be planar
+  detect_non_planar_faces(element);
+
+  for (auto face_idx = 0u; face_idx < num_faces<Element>(); ++face_idx) {
+    const auto& mapping = Element::face_vertex_mapping[face_idx];
+    const auto& normal = element.faces[face_idx].normal;
+
+    if (Element::face_vertex_count[face_idx] == 3u) {
+      const auto weights = sphere_triangle_weights(
+          sphere,
+          {element.vertices[mapping[0]], element.vertices[mapping[1]],
+           element.vertices[mapping[2]]},
+          normal);
+
+      for (auto idx = 0u; idx < 3u; ++idx) {
+        result[mapping[idx]] += weights[idx] * normal;
+      }
+
+      continue;
+    }
+
+    if constexpr (std::extent_v<decltype(Element::face_vertex_mapping), 1> ==
+                  4u) {
+      const auto center =
+          Vector{Scalar{0.25} * (element.vertices[mapping[0]] +
+                                 element.vertices[mapping[1]] +
+                                 element.vertices[mapping[2]] +
+                                 element.vertices[mapping[3]])};
+
+      for (auto idx = 0u; idx < 4u; ++idx) {
+        const auto v0 = mapping[idx];
+        const auto v1 = mapping[(idx + 1) % 4];
+        const auto weights = sphere_triangle_weights(
+            sphere, {element.vertices[v0], element.vertices[v1], center},
+            normal);
+
+        result[v0] += weights[0] * normal;
+        result[v1] += weights[1] * normal;
+        for (auto vertex_idx = 0u; vertex_idx < 4u; ++vertex_idx) {
+          result[mapping[vertex_idx]] += (Scalar{0.25} * weights[2]) * normal;
+        }
+      }
+    }
+  }
+
+  return result;
+}
+
+// Overlap volume of a sphere and an element together with the first moment of
+// the overlap region. By the divergence theorem, the first moment w.r.t. the
+// center of the sphere is the integral of |x - c|^2 n / 2 over the boundary of
+// the region. On the surface of the sphere |x - c|^2 equals r^2, and the
+// integral of the normal over this part is the negative sum of the normals of
+// the faces weighted with their areas inside the sphere. Hence, only the area
+// and the polar second moment of each face within the sphere are required.
+template<typename Element>
+auto overlap_moments(const Sphere& sphere, const Element& element)
+    -> OverlapMoments {
+  using namespace detail;
+
+  static_assert(is_element_v<Element>, "invalid element type detected");
+
+  auto result = OverlapMoments{};
+
+  if (!intersects_coarse(sphere, element)) {
+    return result;
+  }
+
+  // sanity check: all faces of the mesh element have to be planar
+  detect_non_planar_faces(element);
+
+  result.volume = overlap_volume(sphere, element);
+  if (result.volume <= Scalar{0}) {
     return result;
   }
 
-  // initial value for the surface of the sphere: Surface area of the full
-  // sphere
-  result[0] = unit_sphere.surface_area();
+  // first moment w.r.t. the center of the sphere
+  auto moment = Vector{Vector::Zero()};
+  const auto add_face = [&](const auto& polygon, const Vector& normal) {
+    const auto [points, radius_sq] =
+        disk_plane_projection(sphere, polygon, normal);
+    if (radius_sq <= Scalar{0}) {
+      return;
+    }
+
+    const auto moments = disk_polygon_moments(points, std::sqrt(radius_sq));
+    moment -= (Scalar{0.5} * (radius_sq * moments.area - moments.polar)) *
+              normal;
+  };
 
-  // iterate over all the marked faces and calculate the area of the disk
-  // defined by the plane as well as the cap surfaces
   for (auto face_idx = 0u; face_idx < num_faces<Element>(); ++face_idx) {
-    if (!entity_intersections.faces[face_idx]) {
+    const auto& mapping = Element::face_vertex_mapping[face_idx];
+    const auto& normal = element.faces[face_idx].normal;
+
+    if (Element::face_vertex_count[face_idx] == 3u) {
+      add_face(std::array<Vector, 3>{{element.vertices[mapping[0]],
+                                      element.vertices[mapping[1]],
+                                      element.vertices[mapping[2]]}},
+               normal);
       continue;
     }
 
-    const auto& face = transformed_element.faces[face_idx];
-    const auto dist = face.normal.dot(-face.center);
-
-    result[0] -= unit_sphere.cap_surface_area(unit_sphere.radius + dist);
-    result[face_idx + 1] = unit_sphere.disk_area(unit_sphere.radius + dist);
+    if constexpr (std::extent_v<decltype(Element::face_vertex_mapping), 1> ==
+                  4u) {
+      add_face(std::array<Vector, 4>{{element.vertices[mapping[0]],
+                                      element.vertices[mapping[1]],
+                                      element.vertices[mapping[2]],
+                                      element.vertices[mapping[3]]}},
+               normal);
+    }
   }
 
-  const auto circular_segment_area = [](const Scalar radius_sq,
-                                        const Scalar chord_length) {
-    if (std::abs(radius_sq - Scalar{0.25} * chord_length * chord_length) <=
-        tiny_epsilon) {
-      return Scalar{0.5} * radius_sq * pi;
-    }
+  result.first_moment = moment + result.volume * sphere.center;
 
-    const auto apothem = std::sqrt(std::max(
-        Scalar{0}, radius_sq - Scalar{0.25} * chord_length * chord_length));
+  return result;
+}
 
-    const auto theta =
-        Scalar{2} * std::atan2(chord_length, Scalar{2} * apothem);
+// Integral of the radial kernel sum_k coefficients[k] q^k, q = |x - c| / r,
+// over the overlap region of a sphere and an element. The kernel vanishes
+// outside of the sphere, as for SPH kernels with compact support. By the
+// divergence theorem, the integral of q^k equals the integral of
+// q^k (x - c).n / (k + 3) over the boundary of the overlap region. The part on
+// the surface of the sphere only requires the area of the sphere within the
+// element, which follows from the overlap volume. On the faces, (x - c).n is
+// the constant distance of the plane and the remaining radial integral over the
+// face within the sphere is again transformed into an integral along its
+// boundary. Along the arcs this integral is given in closed form, along the
+// straight segments an 8-point Gauss-Legendre rule is used, which is exact for
+// kernels consisting of even powers up to q^14.
+template<typename Element, std::size_t N>
+auto overlap_radial_integral(const Sphere& sphere, const Element& element,
+                             const std::array<Scalar, N>& coefficients)
+    -> Scalar {
+  using namespace detail;
 
-    const auto sector_area = Scalar{0.5} * radius_sq * theta;
-    const auto triangle_area = Scalar{0.5} * chord_length * apothem;
+  static_assert(is_element_v<Element>, "invalid element type detected");
+  static_assert(N > 0, "at least one coefficient is required");
+
+  // nodes and weights of the Gauss-Legendre rule on [0, 1]
+  constexpr auto nodes = std::array<Scalar, 8>{
+      0.0198550717512319, 0.1016667612931866, 0.2372337950418355,
+      0.4082826787521751, 0.5917173212478249, 0.7627662049581645,
+      0.8983332387068134, 0.9801449282487681};
+  constexpr auto weights = std::array<Scalar, 8>{
+      0.0506142681451881, 0.1111905172266872, 0.1568533229389436,
+      0.1813418916891810, 0.1813418916891810, 0.1568533229389436,
+      0.1111905172266872, 0.0506142681451881};
 
-    return sector_area - triangle_area;
-  };
+  if (!intersects_coarse(sphere, element)) {
+    return Scalar{0};
+  }
 
-  // cache the squared radius of the disk formed by the intersection between the
-  // planes defined by each face and the sphere
-  auto intersection_radius_sq = std::array<Scalar, num_faces<Element>()>{};
+  // sanity check: all faces of the mesh element have to be planar
+  detect_non_planar_faces(element);
 
-  // handle the edges and subtract the area of the respective disk cut off by
-  // the edge and add back the surface area of the spherical wedge defined by
-  // the edge
-  for (auto edge_idx = 0u; edge_idx < num_edges<Element>(); ++edge_idx) {
-    if (!entity_intersections.edges[edge_idx]) {
-      continue;
-    }
+  const auto volume = overlap_volume(sphere, element);
+  if (volume <= Scalar{0}) {
+    return Scalar{0};
+  }
 
-    // intersection area of the the sphere: add back the surface area of the
-    // spherical wedge defined by the edge which was considered twice when
-    // processing the two faces forming the edge
-    result[0] += general_wedge<2, Element>(unit_sphere, transformed_element,
-                                           edge_idx, edge_intersections);
+  // coefficients w.r.t. |x - c| including the factor 1 / (k + 3)
+  auto scaled = std::array<Scalar, N>{};
+  auto inv_radius_power = Scalar{1};
+  for (auto k = 0u; k < N; ++k) {
+    scaled[k] = coefficients[k] * inv_radius_power / Scalar(k + 3);
+    inv_radius_power /= sphere.radius;
+  }
 
-    // intersection areas of the all faces: for each of the two faces forming
-    // the edge, remove the part of the disk area beyond the edge
-    //
+  auto result = Scalar{0};
 
-    overlap_assert(edge_intersections[edge_idx].has_value(),
-                   "inconsistent intersection detection for edge");
+  // integral of (x - c).n over the surface of the sphere within the element,
+  // obtained from the volume by subtracting the contributions of the faces
+  auto sphere_flux = Scalar{3} * volume;
 
-    // the chord length is given by the distance of the intersection points of
-    // the sphere and the edge
-    const auto chord =
-        ((transformed_element.vertices[Element::edge_mapping[edge_idx][0][0]] +
-          (*edge_intersections[edge_idx])[0]) -
-         (transformed_element.vertices[Element::edge_mapping[edge_idx][0][1]] +
-          (*edge_intersections[edge_idx])[1]))
-            .eval();
+  const auto add_face = [&](const auto& polygon, const Vector& normal) {
+    const auto [points, radius_sq] =
+        disk_plane_projection(sphere, polygon, normal);
+    if (radius_sq <= Scalar{0}) {
+      return;
+    }
 
-    const auto chord_length = chord.stableNorm();
+    // The radial function g(s) = sum_k scaled[k] (h^2 + s^2)^(k / 2) in the
+    // plane at the distance h is integrated via the antiderivative
+    // Phi(s) = int_0^s g(t) t dt, as the divergence of y Phi(|y|) / |y|^2 is
+    // g(|y|) in 2D. Phi(s) / s^2 is evaluated in terms of a = sqrt(h^2 + s^2)
+    // as sum_k scaled[k] (a^(k+2) - |h|^(k+2)) / ((k + 2) (a^2 - h^2)), where
+    // the difference quotient is expanded to avoid cancellation.
+    const auto dist = normal.dot(polygon[0] - sphere.center);
+    const auto abs_dist = std::abs(dist);
+    const auto phi_ratio = [&](const Scalar a) {
+      if (a + abs_dist <= Scalar{0}) {
+        return Scalar{0.5} * scaled[0];
+      }
 
-    // each edge belongs to two faces, indexed via
-    // Element::edge_mapping[n][1][{0,1}]
-    for (auto local_face_idx = 0u; local_face_idx < 2u; ++local_face_idx) {
-      const auto face_idx = Element::edge_mapping[edge_idx][1][local_face_idx];
-      const auto& face = transformed_element.faces[face_idx];
+      // sum of a^j |h|^(n-1-j) for j < n, n = k + 2
+      auto power_sum = a + abs_dist;
+      auto dist_power = abs_dist;
+      auto sum = Scalar{0};
+      for (auto k = 0u; k < N; ++k) {
+        sum += scaled[k] * power_sum / Scalar(k + 2);
+        dist_power *= abs_dist;
+        power_sum = a * power_sum + dist_power;
+      }
 
-      // height of the spherical cap cut off by the plane containing the face
-      const auto cap_height = unit_sphere.radius - face.normal.dot(face.center);
-      const auto apothem = unit_sphere.radius - cap_height;
-      intersection_radius_sq[face_idx] =
-          cap_height * (unit_sphere.radius + apothem);
+      return sum / (a + abs_dist);
+    };
+
+    // Phi at the circle, where h^2 + s^2 = r^2
+    auto phi_circle = Scalar{0};
+    auto radius_power = sphere.radius * sphere.radius;
+    auto dist_power = abs_dist * abs_dist;
+    for (auto k = 0u; k < N; ++k) {
+      phi_circle += scaled[k] * (radius_power - dist_power) / Scalar(k + 2);
+      radius_power *= sphere.radius;
+      dist_power *= abs_dist;
+    }
 
-      // the part of the base of the spherical cap cut off by the edge
-      auto segment_area =
-          circular_segment_area(intersection_radius_sq[face_idx], chord_length);
+    auto area = Scalar{0};
+    auto integral = Scalar{0};
 
-      const auto chord_center =
-          (Scalar{0.5} *
-           ((transformed_element
-                 .vertices[Element::edge_mapping[edge_idx][0][0]] +
-             (*edge_intersections[edge_idx])[0]) +
-            (transformed_element
-                 .vertices[Element::edge_mapping[edge_idx][0][1]] +
-             (*edge_intersections[edge_idx])[1])))
-              .eval();
+    const auto add_segment = [&](const Vector2& a, const Vector2& b) {
+      const auto c = cross2(a, b);
+      area += Scalar{0.5} * c;
 
-      // projection of the center of the sphere onto the face
-      const auto proj =
-          (unit_sphere.center -
-           face.normal.dot(unit_sphere.center - face.center) * face.normal)
-              .eval();
+      auto sum = Scalar{0};
+      for (auto idx = 0u; idx < nodes.size(); ++idx) {
+        const auto y = Vector2{a + nodes[idx] * (b - a)};
+        sum += weights[idx] * phi_ratio(std::sqrt(dist * dist + y.dot(y)));
+      }
 
-      // if the projected sphere center and the face center fall on opposite
-      // sides of the edge, the area has to be inverted
-      const auto invert_segment_area =
-          chord.cross(proj - chord_center)
-              .dot(chord.cross(face.center - chord_center)) < Scalar{0};
+      integral += c * sum;
+    };
 
-      if (invert_segment_area) {
-        segment_area = intersection_radius_sq[face_idx] * pi - segment_area;
-      }
+    const auto add_arc = [&](const Scalar theta0, const Scalar theta1) {
+      area += Scalar{0.5} * radius_sq * (theta1 - theta0);
+      integral += phi_circle * (theta1 - theta0);
+    };
 
-      result[face_idx + 1] -= segment_area;
-    }
-  }
+    disk_polygon_boundary(points, std::sqrt(radius_sq), add_segment, add_arc);
 
-  for (auto vertex_idx = 0u; vertex_idx < num_vertices<Element>();
-       ++vertex_idx) {
-    if (!entity_intersections.vertices[vertex_idx]) {
+    result += dist * integral;
+    sphere_flux -= dist * area;
+  };
+
+  for (auto face_idx = 0u; face_idx < num_faces<Element>(); ++face_idx) {
+    const auto& mapping = Element::face_vertex_mapping[face_idx];
+    const auto& normal = element.faces[face_idx].normal;
+
+    if (Element::face_vertex_count[face_idx] == 3u) {
+      add_face(std::array<Vector, 3>{{element.vertices[mapping[0]],
+                                      element.vertices[mapping[1]],
+                                      element.vertices[mapping[2]]}},
+               normal);
       continue;
     }
 
-    //
-    // correct the intersection area of the the sphere
-    //
-    result[0] -= vertex_cone_correction<2>(transformed_element,
-                                           edge_intersections, vertex_idx);
+    if constexpr (std::extent_v<decltype(Element::face_vertex_mapping), 1> ==
+                  4u) {
+      add_face(std::array<Vector, 4>{{element.vertices[mapping[0]],
+                                      element.vertices[mapping[1]],
+                                      element.vertices[mapping[2]],
+                                      element.vertices[mapping[3]]}},
+               normal);
+    }
+  }
 
-    // sanity checks: detect negative/excessively large intermediate result
-    overlap_assert(result[0] > -std::sqrt(detail::tiny_epsilon),
-                   "negative area as intermediate result in overlap_area()");
+  // kernel on the surface of the sphere, where q = 1
+  auto sphere_kernel = Scalar{0};
+  for (auto k = 0u; k < N; ++k) {
+    sphere_kernel += coefficients[k] / Scalar(k + 3);
+  }
 
-    overlap_assert(
-        result[0] < unit_sphere.surface_area() + detail::tiny_epsilon,
-        "invalid intermediate result in overlap_area()");
+  result += sphere_kernel * std::max(sphere_flux, Scalar{0});
 
-    //
-    // correct the intersection areas of all facets
-    //
-    // iterate over all the faces joining at this vertex
-    for (auto local_face_idx = 0u; local_face_idx < 3u; ++local_face_idx) {
-      // determine the two edges of this face intersecting at the vertex
-      const auto edge0 = Element::face_mapping[local_face_idx][0];
-      const auto edge1 = Element::face_mapping[local_face_idx][1];
-      const auto edge_indices =
-          std::array{Element::vertex_mapping[vertex_idx][0][edge0],
-                     Element::vertex_mapping[vertex_idx][0][edge1]};
+  return result;
+}
 
-      // extract the (relative) intersection points of these edges with the
-      // sphere furthest from the vertex
-      overlap_assert(edge_intersections[edge_indices[0]].has_value() &&
-                         edge_intersections[edge_indices[1]].has_value(),
-                     "inconsistent intersection detection for edge");
+// Earliest time t >= 0 at which a sphere moving along the line
+// c(t) = c0 + v t, where c0 is the center of the given sphere, touches the
+// element. No value is returned if the sphere misses the element or has
+// already left it.
+template<typename Element>
+auto contact_time(const Sphere& sphere, const Vector& velocity,
+                  const Element& element) -> std::optional<Scalar> {
+  using namespace detail;
 
-      const auto intersection_points =
-          std::array{(*edge_intersections[edge_indices[0]])
-                         [Element::vertex_mapping[vertex_idx][1][edge0]],
+  static_assert(is_element_v<Element>, "invalid element type detected");
 
-                     (*edge_intersections[edge_indices[1]])
-                         [Element::vertex_mapping[vertex_idx][1][edge1]]};
+  if (velocity.isZero()) {
+    return overlap_volume(sphere, element) > Scalar{0}
+               ? std::make_optional(Scalar{0})
+               : std::nullopt;
+  }
 
-      // together with the vertex, this determines the triangle representing one
-      // part of the correction
-      const auto triangle_area =
-          Scalar{0.5} *
-          (intersection_points[0].cross(intersection_points[1])).stableNorm();
+  const auto interval = contact_interval(sphere, velocity, element);
+  if (!interval || interval->second < Scalar{0}) {
+    return std::nullopt;
+  }
 
-      // the second component is the segment defined by the face and the
-      // intersection points
-      const auto chord_length =
-          (intersection_points[0] - intersection_points[1]).stableNorm();
+  return std::max(interval->first, Scalar{0});
+}
 
-      const auto face_idx =
-          Element::vertex_mapping[vertex_idx][2][local_face_idx];
+// Earliest time t >= 0 at which the overlap volume of a sphere moving along
+// the line c(t) = c0 + v t and the element reaches the given volume. The
+// overlap volume along the line is unimodal between the entry and the exit
+// time, see contact_interval(), as the overlap of two convex bodies is
+// log-concave w.r.t. their offset. First, a time with an overlap volume of at
+// least the target volume is located by bisecting on the sign of the time
+// derivative of the volume. The root is then found via Newton's method,
+// safeguarded by bisection, using the derivative from the gradient w.r.t. the
+// center of the sphere, see overlap_volume_gradient(). No value is returned if
+// the volume is never reached.
+template<typename Element>
+auto overlap_volume_time(const Sphere& sphere, const Vector& velocity,
+                         const Element& element, const Scalar volume)
+    -> std::optional<Scalar> {
+  using namespace detail;
 
-      auto segment_area =
-          circular_segment_area(intersection_radius_sq[face_idx], chord_length);
+  static_assert(is_element_v<Element>, "invalid element type detected");
 
-      // determine if the (projected) center of the sphere lies within the
-      // triangle or not; if not, the segment area has to be corrected
-      const auto chord_center =
-          (Scalar{0.5} * (intersection_points[0] + intersection_points[1]))
-              .eval();
+  constexpr auto max_iterations = 100u;
 
-      const auto& face = transformed_element.faces[face_idx];
-      const auto proj = (-face.normal.dot(-face.center) * face.normal).eval();
-      const auto invert_segment_area =
-          chord_center.dot((proj - transformed_element.vertices[vertex_idx]) -
-                           chord_center) > Scalar{0};
+  if (volume <= Scalar{0}) {
+    return contact_time(sphere, velocity, element);
+  }
 
-      if (invert_segment_area) {
-        segment_area = intersection_radius_sq[face_idx] * pi - segment_area;
-      }
+  if (velocity.isZero()) {
+    return overlap_volume(sphere, element) >= volume
+               ? std::make_optional(Scalar{0})
+               : std::nullopt;
+  }
 
-      result[face_idx + 1] += triangle_area + segment_area;
+  const auto interval = contact_interval(sphere, velocity, element);
+  if (!interval || interval->second < Scalar{0}) {
+    return std::nullopt;
+  }
 
-      // sanity checks: detect excessively large intermediate result
-      overlap_assert(
-          result[face_idx + 1] < transformed_element.faces[face_idx].area +
-                                     std::sqrt(detail::large_epsilon),
-          "invalid intermediate result in overlap_area()");
+  // overlap volume and its time derivative
+  const auto evaluate = [&](const Scalar t) {
+    const auto gradient = overlap_volume_gradient(
+        Sphere{sphere.center + t * velocity, sphere.radius}, element);
+
+    return std::make_pair(gradient.volume, gradient.center.dot(velocity));
+  };
+
+  // the volume is below the target at the lower bound and reaches it at the
+  // upper bound. At the entry time, the sphere only touches the element, which
+  // is not evaluated as this is a degenerate configuration.
+  auto lower = std::max(interval->first, Scalar{0});
+  auto upper = interval->second;
+  auto current = std::make_pair(Scalar{0}, Scalar{0});
+  if (lower > interval->first) {
+    current = evaluate(lower);
+    if (current.first >= volume) {
+      return lower;
     }
   }
 
-  // scale the surface areas back for the original objects and clamp values
-  // within reasonable limits
-  const auto scaling = sphere.radius;
-  const auto sphere_limit = std::sqrt(std::numeric_limits<Scalar>::epsilon()) *
-                            unit_sphere.surface_area();
+  const auto time_scale = sphere.radius / velocity.norm();
+  const auto converged = [&](const Scalar width, const Scalar time) {
+    return width <= tiny_epsilon * (std::abs(time) + time_scale);
+  };
 
-  // as the precision of the area calculation deteriorates quickly with a
-  // increasing size ratio between the element and the sphere, the precision
-  // limit applied to the sphere is used as the lower limit for the facets
-  const auto face_limit =
-      std::max(sphere_limit, std::sqrt(std::numeric_limits<Scalar>::epsilon()) *
-                                 transformed_element.surface_area());
+  auto t = lower;
+  auto found = false;
+  for (auto left = lower, right = upper, iteration = 0u;
+       iteration < max_iterations && !converged(right - left, left);
+       ++iteration) {
+    const auto mid = Scalar{0.5} * (left + right);
+    const auto value = evaluate(mid);
+    if (value.first >= volume) {
+      upper = mid;
+      found = true;
+      break;
+    }
 
-  // sanity checks: detect negative/excessively large results for the surface
-  // area of the facets
-  for (auto face_idx = 0u; face_idx < num_faces<Element>(); ++face_idx) {
-    overlap_assert(result[face_idx + 1] > -face_limit,
-                   "negative overlap area for face in overlap_area()");
+    // continue towards the maximum of the volume
+    if (value.second > Scalar{0}) {
+      left = mid;
+      lower = mid;
+      t = mid;
+      current = value;
+    } else {
+      right = mid;
+    }
+  }
 
-    overlap_assert(result[face_idx + 1] <=
-                       transformed_element.faces[face_idx].area + face_limit,
-                   "invalid overlap area for face in overlap_area()");
+  if (!found) {
+    return std::nullopt;
   }
 
-  // surface of the sphere within the element
-  result[0] = (scaling * scaling) * detail::clamp(result[0], Scalar{0},
-                                                  unit_sphere.surface_area(),
-                                                  sphere_limit);
+  for (auto iteration = 0u; iteration < max_iterations; ++iteration) {
+    auto next = Scalar{0.5} * (lower + upper);
+    if (current.second > Scalar{0}) {
+      const auto newton = t + (volume - current.first) / current.second;
+      if (converged(std::abs(newton - t), newton)) {
+        return std::clamp(newton, lower, upper);
+      }
 
-  // surfaces of the mesh element within the sphere
-  for (auto face_idx = 0u; face_idx < num_faces<Element>(); ++face_idx) {
-    result[face_idx + 1] =
-        (scaling * scaling) *
-        detail::clamp(result[face_idx + 1], Scalar{0},
-                      transformed_element.faces[face_idx].area, face_limit);
-  }
+      if (newton > lower && newton < upper) {
+        next = newton;
+      }
+    }
 
-  result.back() =
-      std::accumulate(result.begin() + 1, result.end() - 1, Scalar{0});
+    current = evaluate(next);
+    if (current.first < volume) {
+      lower = next;
+    } else {
+      upper = next;
+    }
 
-  // perform final sanity checks on the result (debug version only)
-  overlap_assert(Scalar{0} <= result[0] && result[0] <= sphere.surface_area(),
-                 "invalid overlap area for sphere surface in overlap_area()");
+    t = next;
+    if (converged(upper - lower, t)) {
+      break;
+    }
+  }
 
-  overlap_assert(
-      Scalar{0} <= result.back() && result.back() <= element.surface_area(),
-      "invalid total overlap area for faces in overlap_area()");
+  return t;
+}
 
-  return result;
+template<typename Element, typename Index>
+auto overlap_area(const Sphere& sphere, const ElementView<Element, Index>& view)
+    -> std::array<Scalar, detail::num_faces<Element>() + 2> {
+  if (!detail::intersects_coarse(sphere, view)) {
+    return std::array<Scalar, detail::num_faces<Element>() + 2>{};
+  }
+
+  return overlap_area(sphere, view.compact());
 }
 
 }  // namespace overlap
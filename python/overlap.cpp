@@ -39,7 +39,8 @@ void create_bindings(py::module& m) {
   static const auto element_names = std::map<std::type_index, std::string>{
       {std::type_index(typeid(Tetrahedron)), "Tetrahedron"},
       {std::type_index(typeid(Wedge)), "Wedge"},
-      {std::type_index(typeid(Hexahedron)), "Hexahedron"}};
+      {std::type_index(typeid(Hexahedron)), "Hexahedron"},
+      {std::type_index(typeid(Pyramid)), "Pyramid"}};
 
   const auto& name = element_names.at(std::type_index(typeid(Element)));
   const auto name_lower =
@@ -108,4 +109,5 @@ PYBIND11_MODULE(_overlap, m) {
   create_bindings<Tetrahedron>(m);
   create_bindings<Wedge>(m);
   create_bindings<Hexahedron>(m);
+  create_bindings<Pyramid>(m);
 }
@@ -12,6 +12,7 @@ Supported primitives
 - tetrahedron (4 nodes/vertices, `overlap.Tetrahedron`)
 - pentahedron/wedge (6 nodes/vertices, `overlap.Wedge`)
 - hexahedron (8 nodes/vertices, `overlap.Hexahedron`)
+- pyramid (5 nodes/vertices, `overlap.Pyramid`)
 
 Main functions
 --------------
@@ -23,6 +24,7 @@ Main functions
 
 from ._overlap import (
     Hexahedron,
+    Pyramid,
     Sphere,
     Tetrahedron,
     Wedge,
@@ -33,6 +35,7 @@ from ._version import __version__, version
 
 __all__ = [
     "Hexahedron",
+    "Pyramid",
     "Sphere",
     "Tetrahedron",
     "Wedge",
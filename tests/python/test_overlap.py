@@ -67,6 +67,21 @@ class TestElements:
         np.testing.assert_almost_equal(hexa.center, [0, 0, 0])
         np.testing.assert_almost_equal(hexa.surface_area, 24.0)
 
+    def test_pyramid(self):
+        vertices = [
+            (-1, -1, 0),
+            (1, -1, 0),
+            (1, 1, 0),
+            (-1, 1, 0),
+            (0, 0, 1),
+        ]
+
+        pyramid = overlap.Pyramid(vertices)
+
+        np.testing.assert_almost_equal(pyramid.volume, 4.0 / 3.0)
+        np.testing.assert_almost_equal(pyramid.center, [0, 0, 0.2])
+        np.testing.assert_almost_equal(pyramid.surface_area, 4.0 + 4 * np.sqrt(2))
+
 
 class TestOverlap:
     def test_tetrahedron(self):
@@ -107,6 +122,20 @@ class TestOverlap:
 
         np.testing.assert_almost_equal(overlap.overlap_volume(sphere, hexa), np.pi / 6)
 
+    def test_pyramid(self):
+        vertices = [
+            (-1, -1, 0),
+            (1, -1, 0),
+            (1, 1, 0),
+            (-1, 1, 0),
+            (0, 0, 1),
+        ]
+
+        pyramid = overlap.Pyramid(vertices)
+        sphere = overlap.Sphere((0, 0, 1), 0.25)
+
+        np.testing.assert_almost_equal(overlap.overlap_volume(sphere, pyramid), sphere.volume / 6)
+
 
 class TestOverlapArea:
     def test_wedge(self):
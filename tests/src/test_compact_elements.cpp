@@ -0,0 +1,130 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include "common.hpp"
+
+#include "overlap/overlap.hpp"
+
+#include <array>
+#include <vector>
+
+namespace {
+
+using namespace overlap;
+
+template<typename Element>
+void check_compact_element(const Element& element) {
+  const auto compact = CompactElement<Element>{element};
+
+  CHECK_LT(sizeof(compact), sizeof(element));
+
+  CHECK_EQ(compact.volume, element.volume);
+  CHECK(compact.center.isApprox(element.center));
+  CHECK_EQ(compact.surface_area(), Approx(element.surface_area()));
+
+  for (auto face_idx = 0u; face_idx < detail::num_faces<Element>();
+       ++face_idx) {
+    CHECK_EQ(compact.face_area(face_idx), Approx(element.faces[face_idx].area));
+  }
+
+  const auto spheres = std::array<Sphere, 7>{
+      Sphere{{5, 0, 0}, 1},          // disjoint
+      Sphere{Vector::Zero(), 0.25},  // contained in the element
+      Sphere{Vector::Zero(), 10},    // contains the element
+      Sphere{{1, 1, 1}, 1},          // vertex of the hexahedron
+      Sphere{{0, -1, 1}, 0.75},      // edge of the hexahedron
+      Sphere{{0, 0, 1}, 0.5},        // face of the hexahedron
+      Sphere{{0.5, -0.25, 0.5}, 0.8},
+  };
+
+  for (const auto& sphere : spheres) {
+    CHECK_EQ(overlap_volume(sphere, compact),
+             Approx(overlap_volume(sphere, element)));
+
+    const auto area = overlap_area(sphere, element);
+    const auto compact_area = overlap_area(sphere, compact);
+    for (auto idx = 0u; idx < area.size(); ++idx) {
+      CHECK_EQ(compact_area[idx], Approx(area[idx]));
+    }
+  }
+}
+
+}  // namespace
+
+TEST_SUITE("CompactElements") {
+  using namespace overlap;
+
+  TEST_CASE("Tetrahedron") {
+    check_compact_element(Tetrahedron{Vector{-1, -1, -1}, Vector{1, -1, -1},
+                                      Vector{0, 1, -1}, Vector{0, 0, 1}});
+  }
+
+  TEST_CASE("Wedge") {
+    check_compact_element(Wedge{Vector{-1, -1, -1}, Vector{1, -1, -1},
+                                Vector{0, 1, -1}, Vector{-1, -1, 1},
+                                Vector{1, -1, 1}, Vector{0, 1, 1}});
+  }
+
+  TEST_CASE("Hexahedron") {
+    check_compact_element(unit_hexahedron());
+    check_compact_element(unit_hexahedron(0.5));
+  }
+
+  TEST_CASE("Normalize") {
+    const auto sphere = Sphere{{0.5, 0.5, 0.5}, 2};
+    const auto hex = unit_hexahedron();
+
+    const auto compact =
+        detail::normalize_element(sphere, CompactHexahedron{hex});
+    const auto reference = detail::normalize_element(sphere, hex);
+
+    CHECK_EQ(compact.volume, Approx(reference.volume));
+    for (auto idx = 0u; idx < reference.vertices.size(); ++idx) {
+      CHECK(compact.vertices[idx].isApprox(reference.vertices[idx]));
+    }
+
+    for (auto idx = 0u; idx < reference.faces.size(); ++idx) {
+      CHECK(compact.faces[idx].center.isApprox(reference.faces[idx].center));
+      CHECK(compact.faces[idx].normal.isApprox(reference.faces[idx].normal));
+      CHECK_EQ(compact.face_area(idx), Approx(reference.faces[idx].area));
+    }
+  }
+
+  TEST_CASE("NonPlanarFaces") {
+    auto hex = unit_hexahedron();
+    hex.vertices[6] += Vector{0.1, 0.0, 0.2};
+
+    CHECK_THROWS_AS(detail::detect_non_planar_faces(CompactHexahedron{hex}),
+                    std::invalid_argument);
+  }
+
+  TEST_CASE("Batch") {
+    const auto hexes = std::vector<Hexahedron>{unit_hexahedron(),
+                                               unit_hexahedron(2.0)};
+    const auto compact_hexes = std::vector<CompactHexahedron>{
+        CompactHexahedron{hexes[0]}, CompactHexahedron{hexes[1]}};
+
+    const auto spheres =
+        std::vector<Sphere>{{{1, 1, 1}, 1}, {{0, 0, 2}, 0.5}};
+
+    auto pairs = std::vector<SphereElementPair>{};
+    for (auto element_idx = 0u; element_idx < hexes.size(); ++element_idx) {
+      for (auto sphere_idx = 0u; sphere_idx < spheres.size(); ++sphere_idx) {
+        pairs.emplace_back(sphere_idx, element_idx);
+      }
+    }
+
+    const auto results = overlap_volume_pairs(spheres, hexes, pairs);
+    const auto compact_results =
+        overlap_volume_pairs(spheres, compact_hexes, pairs);
+
+    REQUIRE_EQ(results.size(), compact_results.size());
+    for (auto idx = 0u; idx < results.size(); ++idx) {
+      CHECK_EQ(compact_results[idx], Approx(results[idx]));
+    }
+  }
+}
@@ -0,0 +1,150 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include "common.hpp"
+
+#include "overlap/overlap.hpp"
+
+#include <random>
+
+TEST_SUITE("ContactTime") {
+  using namespace overlap;
+
+  // clang-format off
+  const auto hex = Hexahedron{{{
+      {-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1},
+      {-1, -1,  1}, {1, -1,  1}, {1, 1,  1}, {-1, 1,  1}}}};
+  // clang-format on
+
+  const auto tet =
+      Tetrahedron{{{{-1, -1, -1}, {1, -1, -1}, {0, 1, -1}, {0, 0, 1}}}};
+
+  auto position(const Sphere& sphere, const Vector& velocity, Scalar t)
+      -> Sphere {
+    return Sphere{sphere.center + t * velocity, sphere.radius};
+  }
+
+  TEST_CASE("Features") {
+    // face
+    const auto face = contact_time(Sphere{{5, 0, 0}, 1}, Vector{-1, 0, 0}, hex);
+    REQUIRE(face.has_value());
+    CHECK_EQ(*face, Approx(3.0));
+
+    // edge along the z-axis at x = y = 1
+    const auto edge =
+        contact_time(Sphere{{3, 3, 0}, 1}, Vector{-1, -1, 0}, hex);
+    REQUIRE(edge.has_value());
+    CHECK_EQ(*edge, Approx(2.0 - 1.0 / std::sqrt(2.0)));
+
+    // vertex at (1, 1, 1)
+    const auto vertex =
+        contact_time(Sphere{{3, 3, 3}, 1}, Vector{-1, -1, -1}, hex);
+    REQUIRE(vertex.has_value());
+    CHECK_EQ(*vertex, Approx(2.0 - 1.0 / std::sqrt(3.0)));
+  }
+
+  TEST_CASE("TrivialCases") {
+    const auto sphere = Sphere{{5, 0, 0}, 1};
+
+    // passing by, moving away and at rest
+    CHECK_FALSE(contact_time(sphere, Vector{0, 1, 0}, hex).has_value());
+    CHECK_FALSE(contact_time(sphere, Vector{1, 0, 0}, hex).has_value());
+    CHECK_FALSE(contact_time(sphere, Vector::Zero(), hex).has_value());
+
+    // overlapping initially
+    const auto overlapping = Sphere{{1.5, 0, 0}, 1};
+    CHECK_EQ(contact_time(overlapping, Vector{1, 0, 0}, hex), 0.0);
+    CHECK_EQ(contact_time(overlapping, Vector::Zero(), hex), 0.0);
+  }
+
+  TEST_CASE("Randomized") {
+    auto generator = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<Scalar>{-1, 1};
+
+    for (auto idx = 0u; idx < 200u; ++idx) {
+      const auto sphere = Sphere{
+          Vector{4.0 * Vector{dist(generator), dist(generator),
+                              dist(generator)}.normalized()},
+          0.3 + 0.5 * std::abs(dist(generator))};
+      const auto target = Vector{
+          0.5 * Vector{dist(generator), dist(generator), dist(generator)}};
+      const auto velocity = Vector{target - sphere.center};
+
+      const auto t = contact_time(sphere, velocity, hex);
+      REQUIRE(t.has_value());
+
+      // no overlap right before the contact, overlap right after it
+      CHECK_EQ(overlap_volume(position(sphere, velocity, *t - 1e-6), hex), 0.0);
+      CHECK_GT(overlap_volume(position(sphere, velocity, *t + 1e-4), hex), 0.0);
+
+      // aiming at a point close to the centroid of the tetrahedron
+      const auto tet_velocity =
+          Vector{tet.center + 0.2 * target - sphere.center};
+      const auto t_tet = contact_time(sphere, tet_velocity, tet);
+      REQUIRE(t_tet.has_value());
+      CHECK_EQ(
+          overlap_volume(position(sphere, tet_velocity, *t_tet - 1e-6), tet),
+          0.0);
+      CHECK_GT(
+          overlap_volume(position(sphere, tet_velocity, *t_tet + 1e-4), tet),
+          0.0);
+    }
+  }
+
+  TEST_CASE("OverlapVolumeTime") {
+    // half of the sphere inside the element once the center reaches the face
+    const auto sphere = Sphere{{5, 0, 0}, 0.5};
+    const auto velocity = Vector{-1, 0, 0};
+
+    const auto half = overlap_volume_time(sphere, velocity, hex,
+                                          0.5 * sphere.volume);
+    REQUIRE(half.has_value());
+    CHECK_EQ(*half, Approx(4.0));
+
+    // the full sphere fits into the element
+    const auto full = overlap_volume_time(sphere, velocity, hex, sphere.volume);
+    REQUIRE(full.has_value());
+    CHECK_EQ(*full, Approx(4.5));
+
+    // larger than the sphere
+    CHECK_FALSE(
+        overlap_volume_time(sphere, velocity, hex, 2.0 * sphere.volume)
+            .has_value());
+
+    // zero volume: first contact
+    CHECK_EQ(overlap_volume_time(sphere, velocity, hex, 0.0), Approx(3.5));
+  }
+
+  TEST_CASE("OverlapVolumeTimeRandomized") {
+    auto generator = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<Scalar>{-1, 1};
+
+    for (auto idx = 0u; idx < 200u; ++idx) {
+      const auto sphere = Sphere{
+          Vector{4.0 * Vector{dist(generator), dist(generator),
+                              dist(generator)}.normalized()},
+          0.3 + 0.5 * std::abs(dist(generator))};
+      const auto target = Vector{
+          tet.center +
+          0.1 * Vector{dist(generator), dist(generator), dist(generator)}};
+      const auto velocity = Vector{target - sphere.center};
+
+      // the sphere passes through the target point inside the element at t = 1
+      const auto max_volume =
+          overlap_volume(position(sphere, velocity, 1.0), tet);
+      const auto volume = (0.1 + 0.8 * std::abs(dist(generator))) * max_volume;
+
+      const auto t = overlap_volume_time(sphere, velocity, tet, volume);
+      REQUIRE(t.has_value());
+      CHECK_LE(*t, 1.0 + 1e-12);
+      CHECK_EQ(overlap_volume(position(sphere, velocity, *t), tet),
+               Approx(volume).epsilon(1e-10));
+      CHECK_LT(overlap_volume(position(sphere, velocity, 0.999 * *t), tet),
+               volume);
+    }
+  }
+}
@@ -0,0 +1,260 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include "common.hpp"
+
+#include "overlap/overlap.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+TEST_SUITE("ConvexPolyhedron") {
+  using namespace overlap;
+
+  using FaceList = std::vector<std::vector<std::uint32_t>>;
+
+  // unit cube, faces ordered counterclockwise when viewed from the outside
+  const auto cube_vertices = std::vector<Vector>{
+      {0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0},
+      {0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1},
+  };
+
+  const auto cube_faces = FaceList{
+      {0, 3, 2, 1}, {0, 1, 5, 4}, {1, 2, 6, 5},
+      {2, 3, 7, 6}, {0, 4, 7, 3}, {4, 5, 6, 7},
+  };
+
+  // Truncated octahedron: 24 vertices given by the permutations of (0, ±1, ±2),
+  // 6 square faces and 8 hexagonal faces. The faces are collected from the
+  // vertices located on the planes bounding the polyhedron.
+  const auto truncated_octahedron = []() {
+    auto vertices = std::vector<Vector>{};
+    for (const auto a : {-1.0, 1.0}) {
+      for (const auto b : {-2.0, 2.0}) {
+        vertices.emplace_back(0, a, b);
+        vertices.emplace_back(0, b, a);
+        vertices.emplace_back(a, 0, b);
+        vertices.emplace_back(b, 0, a);
+        vertices.emplace_back(a, b, 0);
+        vertices.emplace_back(b, a, 0);
+      }
+    }
+
+    auto planes = std::vector<std::pair<Vector, Scalar>>{};
+    for (auto axis = 0; axis < 3; ++axis) {
+      for (const auto sign : {-1.0, 1.0}) {
+        planes.emplace_back(sign * Vector::Unit(axis), 2.0);
+      }
+    }
+
+    for (const auto x : {-1.0, 1.0}) {
+      for (const auto y : {-1.0, 1.0}) {
+        for (const auto z : {-1.0, 1.0}) {
+          planes.emplace_back(Vector{x, y, z}, 3.0);
+        }
+      }
+    }
+
+    auto faces = FaceList{};
+    for (const auto& [normal, offset] : planes) {
+      auto face = std::vector<std::uint32_t>{};
+      auto center = Vector::Zero().eval();
+      for (auto idx = 0u; idx < vertices.size(); ++idx) {
+        if (std::abs(normal.dot(vertices[idx]) - offset) < 1e-12) {
+          face.push_back(idx);
+          center += vertices[idx];
+        }
+      }
+
+      center /= static_cast<Scalar>(face.size());
+
+      // sort the vertices counterclockwise around the outward normal
+      const auto u = (vertices[face[0]] - center).normalized().eval();
+      const auto v = normal.normalized().cross(u).eval();
+      std::sort(face.begin(), face.end(), [&](const auto i, const auto j) {
+        const auto di = (vertices[i] - center).eval();
+        const auto dj = (vertices[j] - center).eval();
+        return std::atan2(di.dot(v), di.dot(u)) <
+               std::atan2(dj.dot(v), dj.dot(u));
+      });
+
+      faces.push_back(face);
+    }
+
+    return ConvexPolyhedron{vertices, faces};
+  }();
+
+  // reference result based on the tetrahedralization of the polyhedron
+  const auto decomposed_volume = [](const Sphere& sphere,
+                                    const ConvexPolyhedron& polyhedron) {
+    auto tets = std::vector<Tetrahedron>{};
+    detail::decompose(polyhedron, tets);
+
+    auto volume = Scalar{0};
+    for (const auto& tet : tets) {
+      volume += overlap_volume(sphere, tet);
+    }
+
+    return volume;
+  };
+
+  TEST_CASE("Topology") {
+    const auto cube = ConvexPolyhedron{cube_vertices, cube_faces};
+
+    CHECK_EQ(cube.num_vertices(), 8u);
+    CHECK_EQ(cube.num_edges(), 12u);
+    CHECK_EQ(cube.num_faces(), 6u);
+    CHECK_EQ(cube.volume, Approx(1.0));
+    CHECK_EQ(cube.surface_area(), Approx(6.0));
+    CHECK(cube.center.isApprox(Vector::Constant(0.5)));
+
+    for (const auto& edge : cube.edges) {
+      CHECK_NE(edge.faces[0], edge.faces[1]);
+    }
+
+    // Euler characteristic of a convex polyhedron
+    const auto& poly = truncated_octahedron;
+    CHECK_EQ(poly.num_vertices(), 24u);
+    CHECK_EQ(poly.num_faces(), 14u);
+    CHECK_EQ(poly.num_vertices() + poly.num_faces(), poly.num_edges() + 2u);
+    CHECK_EQ(poly.volume, Approx(8.0 * std::sqrt(2.0) * std::pow(2.0, 1.5)));
+    CHECK_EQ(poly.surface_area(), Approx((6.0 + 12.0 * std::sqrt(3.0)) * 2.0));
+  }
+
+  TEST_CASE("InvalidTopology") {
+    // missing top face
+    auto open_faces = cube_faces;
+    open_faces.pop_back();
+    CHECK_THROWS_AS(ConvexPolyhedron(cube_vertices, open_faces),
+                    std::invalid_argument);
+
+    auto invalid_faces = cube_faces;
+    invalid_faces[0][0] = 8;
+    CHECK_THROWS_AS(ConvexPolyhedron(cube_vertices, invalid_faces),
+                    std::invalid_argument);
+  }
+
+  TEST_CASE("Cube") {
+    const auto cube = ConvexPolyhedron{cube_vertices, cube_faces};
+    const auto hex = Hexahedron{cube_vertices[0], cube_vertices[1],
+                                cube_vertices[2], cube_vertices[3],
+                                cube_vertices[4], cube_vertices[5],
+                                cube_vertices[6], cube_vertices[7]};
+
+    CHECK_EQ(overlap_volume(Sphere{{5, 0, 0}, 1}, cube), 0.0);
+    CHECK_EQ(overlap_volume(Sphere{{0.5, 0.5, 0.5}, 10}, cube), Approx(1.0));
+
+    const auto inner_sphere = Sphere{{0.5, 0.5, 0.5}, 0.25};
+    CHECK_EQ(overlap_volume(inner_sphere, cube), Approx(inner_sphere.volume));
+
+    auto generator = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<Scalar>{-0.5, 1.5};
+
+    for (auto idx = 0u; idx < 1000u; ++idx) {
+      const auto sphere =
+          Sphere{{dist(generator), dist(generator), dist(generator)},
+                 0.1 + 0.5 * std::abs(dist(generator))};
+
+      CHECK_EQ(overlap_volume(sphere, cube),
+               Approx(overlap_volume(sphere, hex)).epsilon(1e-10));
+    }
+  }
+
+  TEST_CASE("Prism") {
+    const auto vertices = std::vector<Vector>{
+        {-1, -1, -1}, {1, -1, -1}, {0, 1, -1},
+        {-1, -1, 1},  {1, -1, 1},  {0, 1, 1},
+    };
+
+    const auto faces = FaceList{
+        {0, 2, 1}, {0, 1, 4, 3}, {1, 2, 5, 4}, {2, 0, 3, 5}, {3, 4, 5},
+    };
+
+    const auto prism = ConvexPolyhedron{vertices, faces};
+    const auto wedge = Wedge{vertices[0], vertices[1], vertices[2],
+                             vertices[3], vertices[4], vertices[5]};
+
+    CHECK_EQ(prism.volume, Approx(wedge.volume));
+
+    auto generator = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<Scalar>{-1.5, 1.5};
+
+    for (auto idx = 0u; idx < 1000u; ++idx) {
+      const auto sphere =
+          Sphere{{dist(generator), dist(generator), dist(generator)},
+                 0.1 + std::abs(dist(generator))};
+
+      CHECK_EQ(overlap_volume(sphere, prism),
+               Approx(overlap_volume(sphere, wedge)).epsilon(1e-10));
+    }
+  }
+
+  TEST_CASE("Octahedron") {
+    // all vertices join four faces, requiring the tetrahedralization
+    const auto vertices = std::vector<Vector>{
+        {1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1},
+    };
+
+    const auto faces = FaceList{
+        {0, 2, 4}, {2, 1, 4}, {1, 3, 4}, {3, 0, 4},
+        {2, 0, 5}, {1, 2, 5}, {3, 1, 5}, {0, 3, 5},
+    };
+
+    const auto octahedron = ConvexPolyhedron{vertices, faces};
+    CHECK_EQ(octahedron.volume, Approx(4.0 / 3.0));
+
+    // one eighth of the sphere around a vertex is inside the octahedron
+    const auto sphere = Sphere{{0, 0, 1}, 0.25};
+    const auto cap_angle = std::atan(1.0 / std::sqrt(2.0));
+    CHECK_EQ(overlap_volume(sphere, octahedron),
+             Approx(decomposed_volume(sphere, octahedron)));
+    CHECK_GT(overlap_volume(sphere, octahedron), 0.0);
+    CHECK_LT(overlap_volume(sphere, octahedron),
+             sphere.volume * (1.0 - std::cos(cap_angle)));
+  }
+
+  TEST_CASE("TruncatedOctahedron") {
+    auto generator = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<Scalar>{-3.0, 3.0};
+
+    for (auto idx = 0u; idx < 1000u; ++idx) {
+      const auto sphere =
+          Sphere{{dist(generator), dist(generator), dist(generator)},
+                 0.1 + 0.5 * std::abs(dist(generator))};
+
+      CHECK_EQ(overlap_volume(sphere, truncated_octahedron),
+               Approx(decomposed_volume(sphere, truncated_octahedron))
+                   .epsilon(1e-10));
+    }
+  }
+
+  TEST_CASE("SmallVector") {
+    auto values = detail::SmallVector<int, 4>{};
+    const auto* inline_data = values.data();
+
+    for (auto idx = 0; idx < 4; ++idx) {
+      values.push_back(idx);
+    }
+
+    CHECK_EQ(values.data(), inline_data);
+
+    // exceeding the inline capacity moves the elements to the heap
+    values.push_back(4);
+    CHECK_NE(values.data(), inline_data);
+    REQUIRE_EQ(values.size(), 5u);
+    for (auto idx = 0; idx < 5; ++idx) {
+      CHECK_EQ(values[idx], idx);
+    }
+
+    values.clear();
+    CHECK(values.empty());
+    CHECK_EQ(values.data(), inline_data);
+  }
+}
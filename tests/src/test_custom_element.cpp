@@ -0,0 +1,155 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include "common.hpp"
+
+#include "overlap/overlap.hpp"
+
+#include <array>
+#include <cstdint>
+#include <random>
+
+// Parallelepiped spanned by three edge vectors, using the node ordering of a
+// hexahedron. The faces are only set up once and the volume is given by the
+// triple product, instead of the general expressions of the hexahedron.
+class Parallelepiped;
+
+template<>
+struct overlap::element_traits<Parallelepiped> {
+  static constexpr std::uint32_t edge_mapping[12][2][2] = {
+      {{0, 1}, {0, 1}}, {{1, 2}, {0, 2}}, {{2, 3}, {0, 3}}, {{3, 0}, {0, 4}},
+      {{0, 4}, {1, 4}}, {{1, 5}, {1, 2}}, {{2, 6}, {2, 3}}, {{3, 7}, {3, 4}},
+      {{4, 5}, {1, 5}}, {{5, 6}, {2, 5}}, {{6, 7}, {3, 5}}, {{7, 4}, {4, 5}}};
+
+  static constexpr std::uint32_t vertex_mapping[8][3][3] = {
+      {{0, 3, 4}, {0, 1, 0}, {0, 1, 4}},
+      {{0, 1, 5}, {1, 0, 0}, {0, 1, 2}},
+      {{1, 2, 6}, {1, 0, 0}, {0, 2, 3}},
+      {{2, 3, 7}, {1, 0, 0}, {0, 3, 4}},
+      {{4, 8, 11}, {1, 0, 1}, {1, 4, 5}},
+      {{5, 8, 9}, {1, 1, 0}, {1, 2, 5}},
+      {{6, 9, 10}, {1, 1, 0}, {2, 3, 5}},
+      {{7, 10, 11}, {1, 1, 0}, {3, 4, 5}}};
+
+  static constexpr std::uint32_t face_mapping[3][2] = {{0, 1}, {0, 2}, {1, 2}};
+
+  static constexpr std::uint32_t face_vertex_mapping[6][4] = {
+      {3, 2, 1, 0}, {0, 1, 5, 4}, {1, 2, 6, 5},
+      {2, 3, 7, 6}, {3, 0, 4, 7}, {4, 5, 6, 7}};
+
+  static constexpr std::uint32_t face_vertex_count[6] = {4, 4, 4, 4, 4, 4};
+};
+
+class Parallelepiped : public overlap::element_traits<Parallelepiped> {
+ public:
+  using Vector = overlap::Vector;
+
+  Parallelepiped(const Vector& origin, const Vector& a, const Vector& b,
+                 const Vector& c) :
+      vertices{{origin, origin + a, origin + a + b, origin + b, origin + c,
+                origin + a + c, origin + a + b + c, origin + b + c}},
+      center{origin + 0.5 * (a + b + c)},
+      volume{a.cross(b).dot(c)} {
+    for (auto face_idx = 0u; face_idx < faces.size(); ++face_idx) {
+      const auto& mapping = face_vertex_mapping[face_idx];
+      faces[face_idx] =
+          overlap::Quadrilateral{vertices[mapping[0]], vertices[mapping[1]],
+                                 vertices[mapping[2]], vertices[mapping[3]]};
+    }
+  }
+
+  void apply(const overlap::Transformation& t) {
+    for (auto& v : vertices) {
+      v = t.scaling * (v + t.translation);
+    }
+
+    for (auto& f : faces) {
+      f.apply(t);
+    }
+
+    center = t.scaling * (center + t.translation);
+    volume *= t.scaling * t.scaling * t.scaling;
+  }
+
+  [[nodiscard]] auto surface_area() const -> overlap::Scalar {
+    auto area = overlap::Scalar{0};
+    for (const auto& face : faces) {
+      area += face.area;
+    }
+
+    return area;
+  }
+
+  std::array<Vector, 8> vertices;
+  std::array<overlap::Quadrilateral, 6> faces;
+  Vector center;
+  overlap::Scalar volume;
+};
+
+// missing the topology tables
+struct IncompleteElement {
+  std::array<overlap::Vector, 4> vertices;
+  std::array<overlap::Triangle, 4> faces;
+  overlap::Vector center;
+  overlap::Scalar volume;
+
+  void apply(const overlap::Transformation& /*unused*/) {}
+  auto surface_area() const -> overlap::Scalar { return 0; }
+};
+
+TEST_SUITE("CustomElement") {
+  using namespace overlap;
+
+  static_assert(detail::is_element_v<Parallelepiped>);
+  static_assert(!detail::is_element_v<IncompleteElement>);
+  static_assert(!detail::is_element_v<Sphere>);
+
+  static_assert(detail::num_vertices<Parallelepiped>() == 8u);
+  static_assert(detail::num_edges<Parallelepiped>() == 12u);
+  static_assert(detail::num_faces<Parallelepiped>() == 6u);
+
+  const auto origin = Vector{-1, -1, -1};
+  const auto a = Vector{2, 0, 0};
+  const auto b = Vector{0.5, 2, 0};
+  const auto c = Vector{0.25, 0.5, 2};
+
+  const auto element = Parallelepiped{origin, a, b, c};
+  const auto hex = Hexahedron{element.vertices};
+
+  TEST_CASE("Element") {
+    CHECK_EQ(element.volume, Approx(hex.volume));
+    CHECK(element.center.isApprox(hex.center));
+  }
+
+  TEST_CASE("OverlapVolume") {
+    auto generator = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<Scalar>{-2, 2};
+
+    for (auto idx = 0u; idx < 1000u; ++idx) {
+      const auto sphere =
+          Sphere{{dist(generator), dist(generator), dist(generator)},
+                 0.1 + std::abs(dist(generator))};
+
+      CHECK_EQ(overlap_volume(sphere, element),
+               Approx(overlap_volume(sphere, hex)));
+
+      const auto area = overlap_area(sphere, element);
+      const auto reference = overlap_area(sphere, hex);
+      REQUIRE_EQ(area.size(), reference.size());
+      for (auto area_idx = 0u; area_idx < area.size(); ++area_idx) {
+        CHECK_EQ(area[area_idx], Approx(reference[area_idx]));
+      }
+    }
+  }
+
+  TEST_CASE("CompactElement") {
+    const auto sphere = Sphere{{0.5, 0.5, 0}, 1};
+
+    CHECK_EQ(overlap_volume(sphere, CompactElement<Parallelepiped>{element}),
+             Approx(overlap_volume(sphere, hex)));
+  }
+}
@@ -74,6 +74,44 @@ TEST_SUITE("Elements") {
 
       CHECK(wedge.volume == Approx(Scalar{4}).epsilon(epsilon));
     }
+
+    SUBCASE("TriangularFaces") {
+      // clang-format off
+      const auto wedge = Wedge{{{
+        {-1, -1, -1}, {1, -1, -1}, {1, 1, -1},
+        {-1, -1, 2},  {1, -1, 2},  {1, 1, 2}}}};
+      // clang-format on
+
+      CHECK(wedge.volume == Approx(Scalar{6}).epsilon(epsilon));
+
+      const auto& bottom = wedge.faces.get<0>();
+      const auto& top = wedge.faces.get<4>();
+
+      CHECK(bottom.area == Approx(Scalar{2}).epsilon(epsilon));
+      CHECK(top.area == Approx(Scalar{2}).epsilon(epsilon));
+      CHECK(bottom.center.isApprox(Vector{1.0 / 3.0, -1.0 / 3.0, -1}));
+      CHECK(bottom.normal.isApprox(Vector{0, 0, -1}));
+      CHECK(top.normal.isApprox(Vector{0, 0, 1}));
+
+      // access by index yields the data common to all faces
+      CHECK(&wedge.faces[4].area == &top.area);
+      CHECK(wedge.faces[1].area == Approx(Scalar{6}).epsilon(epsilon));
+
+      // iteration works as for the faces of the other elements
+      auto face_idx = 0u;
+      for (const auto& face : wedge.faces) {
+        CHECK(&face == &wedge.faces[face_idx++]);
+      }
+
+      CHECK_EQ(face_idx, wedge.faces.size());
+      CHECK(std::all_of(std::begin(wedge.faces), std::end(wedge.faces),
+                        [](const PolygonBase& face) {
+                          return face.normal.norm() == Approx(Scalar{1});
+                        }));
+
+      CHECK(wedge.surface_area() ==
+            Approx(Scalar{16 + 3 * std::sqrt(8.0)}).epsilon(epsilon));
+    }
   }
 
   TEST_CASE("Hexahedron") {
@@ -0,0 +1,98 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include "common.hpp"
+
+#include "overlap/overlap.hpp"
+
+#include <array>
+#include <numeric>
+#include <vector>
+
+TEST_SUITE("HybridMesh") {
+  using namespace overlap;
+
+  // clang-format off
+  const auto hex = Hexahedron{{{
+      {0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0},
+      {0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1},
+  }}};
+  // clang-format on
+
+  TEST_CASE("Batches") {
+    auto mesh = HybridMesh<Tetrahedron, Wedge, Hexahedron>{};
+
+    auto wedges = std::array<Wedge, 2>{};
+    detail::decompose(hex, wedges);
+
+    auto tets = std::array<Tetrahedron, 5>{};
+    detail::decompose(hex, tets);
+
+    CHECK_EQ(mesh.push_back(wedges[0]), 0u);
+    CHECK_EQ(mesh.push_back(tets[0]), 1u);
+    CHECK_EQ(mesh.push_back(hex), 2u);
+    CHECK_EQ(mesh.push_back(wedges[1]), 3u);
+    CHECK_EQ(mesh.push_back(tets[1]), 4u);
+
+    REQUIRE_EQ(mesh.size(), 5u);
+
+    // elements of the same type are stored contiguously
+    CHECK_EQ(mesh.batch<Wedge>().elements.size(), 2u);
+    CHECK((mesh.batch<Wedge>().indices == std::vector<std::size_t>{0, 3}));
+    CHECK(
+        (mesh.batch<Tetrahedron>().indices == std::vector<std::size_t>{1, 4}));
+    CHECK((mesh.batch<Hexahedron>().indices == std::vector<std::size_t>{2}));
+  }
+
+  TEST_CASE("OverlapVolumes") {
+    auto mesh = HybridMesh<Tetrahedron, Wedge, Hexahedron>{};
+    auto reference = std::vector<Scalar>{};
+
+    // sphere centered on the face shared by the second and the third cell
+    const auto sphere = Sphere{{1, 0.5, 0.5}, 0.45};
+
+    // cells in interleaved order, shifted along the x-axis
+    for (auto cell_idx = 0u; cell_idx < 4u; ++cell_idx) {
+      auto cell = hex;
+      cell.apply(detail::Transformation{Vector{Scalar(cell_idx) - 1, 0, 0}, 1});
+
+      switch (cell_idx % 3) {
+        case 0:
+          mesh.push_back(cell);
+          reference.push_back(overlap_volume(sphere, cell));
+          break;
+        case 1: {
+          auto wedges = std::array<Wedge, 2>{};
+          detail::decompose(cell, wedges);
+          for (const auto& wedge : wedges) {
+            mesh.push_back(wedge);
+            reference.push_back(overlap_volume(sphere, wedge));
+          }
+          break;
+        }
+        default: {
+          auto tets = std::array<Tetrahedron, 5>{};
+          detail::decompose(cell, tets);
+          for (const auto& tet : tets) {
+            mesh.push_back(tet);
+            reference.push_back(overlap_volume(sphere, tet));
+          }
+          break;
+        }
+      }
+    }
+
+    const auto volumes = overlap_volumes(sphere, mesh);
+    REQUIRE_EQ(volumes.size(), reference.size());
+    for (auto idx = 0u; idx < volumes.size(); ++idx) {
+      CHECK_EQ(volumes[idx], reference[idx]);
+    }
+
+    CHECK_EQ(std::accumulate(volumes.begin(), volumes.end(), 0.0),
+             Approx(sphere.volume));
+  }
+}
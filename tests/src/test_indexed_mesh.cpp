@@ -0,0 +1,129 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include "common.hpp"
+
+#include "overlap/overlap.hpp"
+
+#include <cstdint>
+#include <vector>
+
+TEST_SUITE("IndexedMesh") {
+  using namespace overlap;
+
+  // two unit cubes sharing the face at x = 1
+  const auto vertices = std::vector<Vector>{
+      {0, 0, 0}, {1, 0, 0}, {2, 0, 0}, {0, 1, 0}, {1, 1, 0}, {2, 1, 0},
+      {0, 0, 1}, {1, 0, 1}, {2, 0, 1}, {0, 1, 1}, {1, 1, 1}, {2, 1, 1},
+  };
+
+  const auto connectivity = std::vector<std::uint32_t>{
+      0, 1, 4, 3, 6, 7, 10, 9,   // first hexahedron
+      1, 2, 5, 4, 7, 8, 11, 10,  // second hexahedron
+  };
+
+  TEST_CASE("Views") {
+    const auto mesh = IndexedMesh<Hexahedron>{vertices, connectivity};
+
+    REQUIRE_EQ(mesh.size(), 2u);
+    CHECK_EQ(mesh.vertices().size(), vertices.size());
+
+    // the vertices of the shared face are referenced, not copied
+    CHECK_EQ(&mesh[0].vertex(1), &mesh[1].vertex(0));
+    CHECK_EQ(&mesh[0].vertex(6), &mesh[1].vertex(7));
+
+    const auto hex = mesh[1].element();
+    CHECK(hex.vertices[0].isApprox(Vector{1, 0, 0}));
+    CHECK(hex.vertices[6].isApprox(Vector{2, 1, 1}));
+    CHECK_EQ(hex.volume, Approx(1.0));
+  }
+
+  // the compact element set up from the view matches the one derived from the
+  // full element
+  template<typename Element, typename Index>
+  void check_compact(const IndexedMesh<Element, Index>& mesh) {
+    for (auto element_idx = 0u; element_idx < mesh.size(); ++element_idx) {
+      const auto compact = mesh[element_idx].compact();
+      const auto reference =
+          CompactElement<Element>{mesh[element_idx].element()};
+
+      for (auto idx = 0u; idx < compact.vertex_count; ++idx) {
+        CHECK_EQ(compact.vertices[idx], reference.vertices[idx]);
+      }
+
+      for (auto idx = 0u; idx < compact.face_count; ++idx) {
+        CHECK_EQ(compact.faces[idx].center, reference.faces[idx].center);
+        CHECK_EQ(compact.faces[idx].normal, reference.faces[idx].normal);
+      }
+
+      CHECK_EQ(compact.center, reference.center);
+      CHECK_EQ(compact.volume, reference.volume);
+    }
+  }
+
+  TEST_CASE("Compact") {
+    check_compact(IndexedMesh<Hexahedron>{vertices, connectivity});
+    check_compact(IndexedMesh<Tetrahedron>{
+        vertices, std::vector<std::uint32_t>{0, 1, 3, 6, 1, 4, 3, 10}});
+    check_compact(IndexedMesh<Wedge>{
+        vertices, std::vector<std::uint32_t>{0, 1, 3, 6, 7, 9}});
+    check_compact(IndexedMesh<Pyramid>{
+        vertices, std::vector<std::uint32_t>{1, 2, 5, 4, 9}});
+  }
+
+  TEST_CASE("OverlapVolume") {
+    const auto mesh = IndexedMesh<Hexahedron>{vertices, connectivity};
+
+    // sphere centered on the shared face, split evenly between the elements
+    const auto sphere = Sphere{{1, 0.5, 0.5}, 0.25};
+
+    for (auto element_idx = 0u; element_idx < mesh.size(); ++element_idx) {
+      const auto view = mesh[element_idx];
+
+      CHECK_EQ(overlap_volume(sphere, view),
+               overlap_volume(sphere, view.element()));
+      CHECK_EQ(overlap_volume(sphere, view), Approx(0.5 * sphere.volume));
+
+      const auto area = overlap_area(sphere, view);
+      const auto reference = overlap_area(sphere, view.element());
+      for (auto idx = 0u; idx < area.size(); ++idx) {
+        CHECK_EQ(area[idx], reference[idx]);
+      }
+    }
+
+    // no element is instantiated for disjoint configurations
+    const auto far_sphere = Sphere{{10, 0, 0}, 1};
+    CHECK_EQ(overlap_volume(far_sphere, mesh[0]), 0.0);
+    CHECK_EQ(overlap_area(far_sphere, mesh[0]).back(), 0.0);
+  }
+
+  TEST_CASE("Tetrahedra") {
+    // two tetrahedra within the first unit cube sharing the edge 1-3
+    const auto tet_connectivity =
+        std::vector<std::size_t>{0, 1, 3, 6, 1, 4, 3, 10};
+    const auto mesh =
+        IndexedMesh<Tetrahedron, std::size_t>{vertices, tet_connectivity};
+
+    REQUIRE_EQ(mesh.size(), 2u);
+
+    const auto sphere = Sphere{{0.5, 0.5, 0.5}, 0.75};
+    for (auto element_idx = 0u; element_idx < mesh.size(); ++element_idx) {
+      CHECK_EQ(overlap_volume(sphere, mesh[element_idx]),
+               overlap_volume(sphere, mesh[element_idx].element()));
+    }
+  }
+
+  TEST_CASE("InvalidConnectivity") {
+    CHECK_THROWS_AS(
+        IndexedMesh<Hexahedron>(vertices, std::vector<std::uint32_t>{0, 1, 2}),
+        std::invalid_argument);
+
+    CHECK_THROWS_AS(IndexedMesh<Tetrahedron>(
+                        vertices, std::vector<std::uint32_t>{0, 1, 3, 12}),
+                    std::invalid_argument);
+  }
+}
@@ -0,0 +1,112 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include "common.hpp"
+
+#include "overlap/overlap.hpp"
+
+TEST_SUITE("intersection_signature") {
+  using namespace overlap;
+  using detail::IntersectionSignature;
+
+  auto signature(const Sphere& sphere, const Hexahedron& hex)
+      -> IntersectionSignature {
+    const auto element = detail::normalize_element(sphere, hex);
+    const auto [entities, edges] = detail::unit_sphere_intersections(element);
+
+    return detail::intersection_signature(entities);
+  }
+
+  // The specialized kernels have to reproduce the general inclusion-exclusion
+  // loops exactly.
+  void validate_kernels(const Sphere& sphere, const Hexahedron& hex) {
+    const auto element = detail::normalize_element(sphere, hex);
+    const auto [entities, edges] = detail::unit_sphere_intersections(element);
+
+    CHECK_EQ(detail::unit_overlap_volume(element, entities, edges),
+             detail::general_overlap_volume(element, entities, edges));
+  }
+
+  TEST_CASE("Face") {
+    const auto sphere = Sphere{{0, 0, 1.5}, 1};
+
+    CHECK_EQ(signature(sphere, unit_hexahedron()), IntersectionSignature::face);
+    validate_kernels(sphere, unit_hexahedron());
+
+    CHECK(overlap_volume(sphere, unit_hexahedron()) ==
+          Approx(sphere.cap_volume(0.5)));
+  }
+
+  TEST_CASE("TwoOpposingFaces") {
+    const auto sphere = Sphere{Vector::Zero(), 1.2};
+    const auto hex = Hexahedron{{{{-4, -4, -1},
+                                  {4, -4, -1},
+                                  {4, 4, -1},
+                                  {-4, 4, -1},
+                                  {-4, -4, 1},
+                                  {4, -4, 1},
+                                  {4, 4, 1},
+                                  {-4, 4, 1}}}};
+
+    CHECK_EQ(signature(sphere, hex), IntersectionSignature::general);
+    validate_kernels(sphere, hex);
+  }
+
+  TEST_CASE("Edge") {
+    const auto sphere = Sphere{{0, -1, 1}, 1};
+
+    CHECK_EQ(signature(sphere, unit_hexahedron()), IntersectionSignature::edge);
+    validate_kernels(sphere, unit_hexahedron());
+
+    CHECK(overlap_volume(sphere, unit_hexahedron()) ==
+          Approx(0.25 * sphere.volume));
+  }
+
+  TEST_CASE("Vertex") {
+    const auto sphere = Sphere{{1, -1, 1}, 1};
+
+    CHECK_EQ(signature(sphere, unit_hexahedron()),
+             IntersectionSignature::general);
+    validate_kernels(sphere, unit_hexahedron());
+  }
+
+  TEST_CASE("FirstSet") {
+    CHECK_EQ(detail::first_set(detail::BitMask<6>{0b000000}), 6u);
+    CHECK_EQ(detail::first_set(detail::BitMask<6>{0b000001}), 0u);
+    CHECK_EQ(detail::first_set(detail::BitMask<6>{0b101000}), 3u);
+  }
+
+  TEST_CASE("BitMask") {
+    using Mask = detail::BitMask<12>;
+
+    // bits beyond the size of the mask are dropped
+    static_assert(Mask{0xffffu}.count() == 12u);
+    static_assert(Mask{0b100100}[2] && !Mask{0b100100}[3]);
+    static_assert(Mask{}.set(11).bits() == 0b100000000000u);
+    static_assert(Mask{0b11}.set(0, false) == Mask{0b10});
+    static_assert(Mask{}.none() && Mask{0b1000}.any());
+    static_assert(detail::first_set(Mask{0b101000}) == 3u);
+
+    // the topology tables are usable in constant expressions
+    static_assert(Hexahedron::edge_mapping[11][0][0] == 7u);
+    static_assert(Pyramid::face_vertex_count[Pyramid::apex] == 3u);
+
+    // vertex 0 of a hexahedron joins the edges 0, 3 and 4
+    using VertexMask = detail::BitMask<8>;
+    using EdgeMask = detail::BitMask<12>;
+    static_assert(detail::correct_marked_vertices<Hexahedron>(
+                      VertexMask{0b11}, EdgeMask{0b11001}) == VertexMask{0b1});
+    static_assert(detail::correct_marked_vertices<Hexahedron>(
+                      VertexMask{0b1}, EdgeMask{0b01001}) == VertexMask{});
+
+    auto mask = Mask{};
+    mask.set(4).set(7);
+    CHECK_EQ(mask.count(), 2u);
+    CHECK(mask[4]);
+    CHECK_FALSE(mask[5]);
+  }
+}
@@ -0,0 +1,145 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include "common.hpp"
+
+#include "overlap/overlap.hpp"
+
+#include <cmath>
+#include <random>
+
+TEST_SUITE("LatticeCache") {
+  using namespace overlap;
+
+  // unit cube with its origin at zero, the reference cell of the lattice
+  // clang-format off
+  const auto cell = Hexahedron{{{
+      {0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0},
+      {0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1}}}};
+  // clang-format on
+
+  const auto tet =
+      Tetrahedron{{{{-1, -1, -1}, {1, -1, -1}, {0, 1, -1}, {0, 0, 1}}}};
+
+  auto translated(const Hexahedron& hex, const Vector& translation)
+      -> Hexahedron {
+    auto result = hex.vertices;
+    for (auto& vertex : result) {
+      vertex += translation;
+    }
+
+    return Hexahedron{result};
+  }
+
+  TEST_CASE("InvalidArguments") {
+    REQUIRE_THROWS_AS(LatticeCache<Hexahedron>(cell, 0.0),
+                      std::invalid_argument);
+    REQUIRE_THROWS_AS(OverlapVolumeTable<Hexahedron>(cell, 0.0, 8),
+                      std::invalid_argument);
+    REQUIRE_THROWS_AS(OverlapVolumeTable<Hexahedron>(cell, 0.5, 1),
+                      std::invalid_argument);
+  }
+
+  TEST_CASE("Cache") {
+    const auto tolerance = 1e-3;
+    auto cache = LatticeCache<Hexahedron>{cell, tolerance};
+
+    // the same relative position in different cells of the lattice
+    const auto sphere = Sphere{{0.25, 0.5, 1.0}, 0.5};
+    const auto reference = overlap_volume(sphere, cell);
+    for (auto idx = 0; idx < 4; ++idx) {
+      const auto translation = Vector{Scalar(idx), Scalar(-idx), 2.0};
+      const auto shifted = Sphere{sphere.center + translation, sphere.radius};
+
+      CHECK_EQ(cache.volume(shifted, translation), Approx(reference));
+    }
+
+    CHECK_EQ(cache.size(), 1u);
+    CHECK_EQ(cache.hits(), 3u);
+    CHECK_EQ(cache.misses(), 1u);
+
+    cache.clear();
+    CHECK_EQ(cache.size(), 0u);
+    CHECK_EQ(cache.hits(), 0u);
+  }
+
+  TEST_CASE("CacheTolerance") {
+    auto generator = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<Scalar>{-0.5, 1.5};
+
+    const auto tolerance = 1e-4;
+    auto cache = LatticeCache<Hexahedron>{cell, tolerance};
+
+    for (auto idx = 0u; idx < 1000u; ++idx) {
+      const auto translation =
+          Vector{std::round(10.0 * dist(generator)),
+                 std::round(10.0 * dist(generator)),
+                 std::round(10.0 * dist(generator))};
+      const auto sphere =
+          Sphere{Vector{translation + Vector{dist(generator), dist(generator),
+                                             dist(generator)}},
+                 0.1 + std::abs(dist(generator))};
+
+      // gradient w.r.t. the center bounded by pi r^2, w.r.t. the radius by the
+      // surface area of the sphere
+      const auto max_error =
+          detail::pi * sphere.radius * sphere.radius *
+          (std::sqrt(3.0) + 4.0) * tolerance;
+
+      const auto exact = overlap_volume(sphere, translated(cell, translation));
+      CHECK(std::abs(cache.volume(sphere, translation) - exact) <= max_error);
+    }
+  }
+
+  TEST_CASE("Table") {
+    const auto radius = 0.4;
+    const auto table = OverlapVolumeTable<Hexahedron>{cell, radius, 33};
+
+    // nodes of the table are exact
+    const auto node = Vector{table.origin() + 16.0 * table.spacing()};
+    CHECK_EQ(table.volume(node), Approx(overlap_volume(Sphere{node, radius},
+                                                       cell)));
+
+    // outside of the table
+    CHECK_EQ(table.volume(Vector{5, 0, 0}), 0.0);
+
+    auto generator = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<Scalar>{-0.5, 1.5};
+
+    auto max_error = Scalar{0};
+    for (auto idx = 0u; idx < 1000u; ++idx) {
+      const auto translation = Vector{3, -2, 7};
+      const auto center = Vector{
+          translation +
+          Vector{dist(generator), dist(generator), dist(generator)}};
+
+      const auto exact = overlap_volume(Sphere{center, radius},
+                                        translated(cell, translation));
+      max_error = std::max(
+          max_error, std::abs(table.volume(center, translation) - exact));
+    }
+
+    CHECK_LE(max_error, table.error_bound());
+  }
+
+  TEST_CASE("TableTetrahedron") {
+    const auto radius = 0.75;
+    const auto table = OverlapVolumeTable<Tetrahedron>{tet, radius, 17};
+
+    auto generator = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<Scalar>{-2, 2};
+
+    for (auto idx = 0u; idx < 1000u; ++idx) {
+      const auto center =
+          Vector{dist(generator), dist(generator), dist(generator)};
+
+      CHECK(std::abs(table.volume(center) -
+                     overlap_volume(Sphere{center, radius}, tet)) <=
+            table.error_bound());
+    }
+  }
+}
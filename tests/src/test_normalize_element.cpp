@@ -57,4 +57,31 @@ TEST_SUITE("normalize_element") {
                  0.5 * reference.faces[face_idx].center);
     }
   }
+
+  TEST_CASE("Compact") {
+    // the compact representation is transformed without copying the element
+    const auto sphere = Sphere{Vector{0.5, -0.25, 1}, 0.75};
+    const auto reference = unit_hexahedron();
+    const auto normalized = detail::normalize_element(sphere, reference);
+    const auto compact = detail::normalize_compact(sphere, reference);
+
+    CHECK_EQ(compact.volume, Approx(normalized.volume));
+    CHECK(compact.center.isApprox(normalized.center));
+
+    for (auto vertex_idx = 0u; vertex_idx < detail::num_vertices<Hexahedron>();
+         ++vertex_idx) {
+      REQUIRE_EQ(compact.vertices[vertex_idx],
+                 normalized.vertices[vertex_idx]);
+    }
+
+    for (auto face_idx = 0u; face_idx < detail::num_faces<Hexahedron>();
+         ++face_idx) {
+      REQUIRE_EQ(compact.faces[face_idx].center,
+                 normalized.faces[face_idx].center);
+      REQUIRE_EQ(compact.faces[face_idx].normal,
+                 normalized.faces[face_idx].normal);
+      CHECK_EQ(compact.face_area(face_idx),
+               Approx(normalized.faces[face_idx].area));
+    }
+  }
 }
@@ -0,0 +1,127 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include "common.hpp"
+
+#include "overlap/overlap.hpp"
+
+#include <random>
+#include <vector>
+
+TEST_SUITE("Octree") {
+  using namespace overlap;
+
+  // octree covering [0, 4]^3, refined up to level 3 towards the origin
+  auto adaptive_octree() -> Octree {
+    auto octree = Octree{Vector::Zero(), Vector::Constant(4)};
+    auto first = octree.refine(0);
+    for (auto level = 1u; level < 3u; ++level) {
+      first = octree.refine(first);
+    }
+
+    return octree;
+  }
+
+  TEST_CASE("Refine") {
+    auto octree = Octree{Vector::Zero(), Vector::Constant(2)};
+    CHECK_EQ(octree.size(), 1u);
+    CHECK_EQ(octree.depth(), 1u);
+    CHECK(octree.is_leaf(0));
+
+    const auto first = octree.refine(0);
+    CHECK_EQ(first, 1u);
+    CHECK_EQ(octree.size(), 9u);
+    CHECK_EQ(octree.depth(), 2u);
+    CHECK_EQ(octree.leaf_count(), 8u);
+    CHECK_FALSE(octree.is_leaf(0));
+
+    // children ordered with x varying fastest
+    CHECK(octree.node(first + 5).box.min().isApprox(Vector{1, 0, 1}));
+    CHECK(octree.node(first + 5).box.max().isApprox(Vector{2, 1, 2}));
+    CHECK_EQ(octree.node(first + 5).level, 1u);
+    CHECK_EQ(octree.cell(first + 5).volume, Approx(1.0));
+
+    REQUIRE_THROWS_AS(octree.refine(0), std::invalid_argument);
+    REQUIRE_THROWS_AS(octree.refine(100), std::invalid_argument);
+    REQUIRE_THROWS_AS(Octree(Vector::Zero(), Vector{1, 0, 1}),
+                      std::invalid_argument);
+  }
+
+  TEST_CASE("TrivialCases") {
+    const auto octree = adaptive_octree();
+
+    // only the root is tested in both cases
+    auto far_statistics = OctreeStatistics{};
+    const auto far =
+        overlap_volumes(Sphere{{10, 0, 0}, 1}, octree, &far_statistics);
+    CHECK_EQ(far.volumes[0], 0.0);
+    CHECK_EQ(far_statistics.visited_nodes, 1u);
+    CHECK_EQ(far_statistics.contained_leaves, 0u);
+    CHECK_EQ(far_statistics.exact_leaves, 0u);
+
+    // sphere containing the whole tree
+    auto large_statistics = OctreeStatistics{};
+    const auto large =
+        overlap_volumes(Sphere{{2, 2, 2}, 4}, octree, &large_statistics);
+    CHECK_EQ(large_statistics.visited_nodes, 1u);
+    CHECK_EQ(large_statistics.contained_leaves, octree.leaf_count());
+    CHECK_EQ(large_statistics.exact_leaves, 0u);
+    CHECK_EQ(large.volumes[0], Approx(64.0));
+    CHECK_EQ(large.level_volumes[0], 0.0);
+    CHECK_EQ(large.level_volumes[1], Approx(56.0));
+    CHECK_EQ(large.level_volumes[2], Approx(7.0));
+    CHECK_EQ(large.level_volumes[3], Approx(1.0));
+
+    // sphere inside the tree
+    const auto sphere = Sphere{{0.9, 1.1, 0.8}, 0.6};
+    const auto small = overlap_volumes(sphere, octree);
+    CHECK_EQ(small.volumes[0], Approx(sphere.volume));
+  }
+
+  TEST_CASE("Randomized") {
+    const auto octree = adaptive_octree();
+    REQUIRE_EQ(octree.depth(), 4u);
+
+    auto generator = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<Scalar>{-0.5, 4.5};
+    auto radius_dist = std::uniform_real_distribution<Scalar>{0.1, 2.5};
+
+    auto statistics = OctreeStatistics{};
+    for (auto idx = 0u; idx < 200u; ++idx) {
+      const auto sphere =
+          Sphere{{dist(generator), dist(generator), dist(generator)},
+                 radius_dist(generator)};
+
+      const auto result = overlap_volumes(sphere, octree, &statistics);
+
+      auto total = Scalar{0};
+      auto levels = std::vector<Scalar>(octree.depth(), Scalar{0});
+      for (auto node_idx = 0u; node_idx < octree.size(); ++node_idx) {
+        const auto reference = overlap_volume(sphere, octree.cell(node_idx));
+        CHECK_EQ(result.volumes[node_idx],
+                 Approx(reference).epsilon(1e-10).scale(1.0));
+
+        if (octree.is_leaf(node_idx)) {
+          total += reference;
+          levels[octree.node(node_idx).level] += reference;
+        }
+      }
+
+      CHECK_EQ(result.volumes[0], Approx(total).epsilon(1e-10).scale(1.0));
+      for (auto level = 0u; level < octree.depth(); ++level) {
+        CHECK_EQ(result.level_volumes[level],
+                 Approx(levels[level]).epsilon(1e-10).scale(1.0));
+      }
+    }
+
+    CHECK_EQ(statistics.queries, 200u);
+    CHECK_LT(statistics.visited_nodes, 200u * octree.size());
+    CHECK_GT(statistics.exact_leaves, 0u);
+    CHECK_LE(statistics.contained_leaves + statistics.exact_leaves,
+             200u * octree.leaf_count());
+  }
+}
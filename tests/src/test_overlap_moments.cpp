@@ -0,0 +1,111 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include "common.hpp"
+
+#include "overlap/overlap.hpp"
+
+#include <array>
+#include <random>
+
+TEST_SUITE("OverlapMoments") {
+  using namespace overlap;
+
+  // clang-format off
+  const auto hex = Hexahedron{{{
+      {-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1},
+      {-1, -1,  1}, {1, -1,  1}, {1, 1,  1}, {-1, 1,  1}}}};
+  // clang-format on
+
+  const auto tet =
+      Tetrahedron{{{{-1, -1, -1}, {1, -1, -1}, {0, 1, -1}, {0, 0, 1}}}};
+
+  const auto pyramid = Pyramid{
+      {{{-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1}, {0, 0, 1}}}};
+
+  void check_vector(const Vector& value, const Vector& reference) {
+    for (auto dim = 0; dim < 3; ++dim) {
+      CHECK_EQ(value[dim], Approx(reference[dim]).epsilon(1e-10).scale(1.0));
+    }
+  }
+
+  // the moments are additive w.r.t. the decomposition of the element
+  template<typename Element, std::size_t N>
+  void check_decomposition(const Sphere& sphere, const Element& element,
+                           const std::array<Tetrahedron, N>& tets) {
+    const auto moments = overlap_moments(sphere, element);
+
+    auto reference = OverlapMoments{};
+    for (const auto& t : tets) {
+      const auto m = overlap_moments(sphere, t);
+      reference.volume += m.volume;
+      reference.first_moment += m.first_moment;
+    }
+
+    CHECK_EQ(moments.volume, Approx(overlap_volume(sphere, element)));
+    CHECK_EQ(moments.volume, Approx(reference.volume).epsilon(1e-10));
+    check_vector(moments.first_moment, reference.first_moment);
+  }
+
+  TEST_CASE("TrivialCases") {
+    // disjoint
+    const auto far = overlap_moments(Sphere{{5, 0, 0}, 1}, hex);
+    CHECK_EQ(far.volume, 0.0);
+    CHECK(far.first_moment.isZero());
+
+    // element inside the sphere: centroid of the element
+    const auto large = overlap_moments(Sphere{{0.5, 0, 0}, 5}, tet);
+    CHECK_EQ(large.volume, Approx(tet.volume));
+    check_vector(large.first_moment, tet.volume * tet.center);
+
+    // sphere inside the element: center of the sphere
+    const auto sphere = Sphere{{0.2, -0.1, 0.3}, 0.5};
+    const auto small = overlap_moments(sphere, hex);
+    CHECK_EQ(small.volume, Approx(sphere.volume));
+    check_vector(small.first_moment, sphere.volume * sphere.center);
+  }
+
+  TEST_CASE("Hemisphere") {
+    // the centroid of a hemisphere is located at 3 r / 8 from the center
+    const auto sphere = Sphere{{1, 0.2, 0}, 0.5};
+    const auto moments = overlap_moments(sphere, hex);
+
+    CHECK_EQ(moments.volume, Approx(0.5 * sphere.volume));
+    check_vector(Vector{moments.first_moment / moments.volume},
+                 Vector{sphere.center - Vector{0.375 * sphere.radius, 0, 0}});
+  }
+
+  TEST_CASE("Octant") {
+    const auto sphere = Sphere{{1, 1, 1}, 0.5};
+    const auto moments = overlap_moments(sphere, hex);
+
+    CHECK_EQ(moments.volume, Approx(sphere.volume / 8.0));
+    check_vector(Vector{moments.first_moment / moments.volume},
+                 Vector{sphere.center -
+                        Vector::Constant(0.375 * sphere.radius)});
+  }
+
+  TEST_CASE("Randomized") {
+    auto hex_tets = std::array<Tetrahedron, 6>{};
+    detail::decompose(hex, hex_tets);
+
+    auto pyramid_tets = std::array<Tetrahedron, 2>{};
+    detail::decompose(pyramid, pyramid_tets);
+
+    auto generator = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<Scalar>{-1.5, 1.5};
+
+    for (auto idx = 0u; idx < 1000u; ++idx) {
+      const auto sphere =
+          Sphere{{dist(generator), dist(generator), dist(generator)},
+                 0.2 + std::abs(dist(generator))};
+
+      check_decomposition(sphere, hex, hex_tets);
+      check_decomposition(sphere, pyramid, pyramid_tets);
+    }
+  }
+}
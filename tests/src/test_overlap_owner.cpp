@@ -0,0 +1,85 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include "common.hpp"
+
+#include "overlap/overlap.hpp"
+
+#include <random>
+#include <vector>
+
+TEST_SUITE("OverlapOwner") {
+  using namespace overlap;
+
+  // 4 x 4 x 4 grid of unit cubes covering [0, 4]^3
+  const auto grid = [] {
+    auto result = std::vector<Hexahedron>{};
+    for (auto k = 0; k < 4; ++k) {
+      for (auto j = 0; j < 4; ++j) {
+        for (auto i = 0; i < 4; ++i) {
+          const auto o = Vector{Scalar(i), Scalar(j), Scalar(k)};
+          result.emplace_back(
+              Vector{o + Vector{0, 0, 0}}, Vector{o + Vector{1, 0, 0}},
+              Vector{o + Vector{1, 1, 0}}, Vector{o + Vector{0, 1, 0}},
+              Vector{o + Vector{0, 0, 1}}, Vector{o + Vector{1, 0, 1}},
+              Vector{o + Vector{1, 1, 1}}, Vector{o + Vector{0, 1, 1}});
+        }
+      }
+    }
+
+    return result;
+  }();
+
+  TEST_CASE("TrivialCases") {
+    // disjoint
+    const auto far = overlap_owner(Sphere{{10, 0, 0}, 1}, grid.begin(),
+                                   grid.end());
+    CHECK(far.first == grid.end());
+    CHECK_EQ(far.second, 0.0);
+
+    // empty range
+    const auto empty =
+        overlap_owner(Sphere{{2, 2, 2}, 1}, grid.begin(), grid.begin());
+    CHECK(empty.first == grid.begin());
+    CHECK_EQ(empty.second, 0.0);
+
+    // sphere inside of a single cell
+    const auto sphere = Sphere{{1.5, 2.5, 0.5}, 0.25};
+    const auto inside = overlap_owner(sphere, grid.begin(), grid.end());
+    CHECK_EQ(std::distance(grid.begin(), inside.first), 9);
+    CHECK_EQ(inside.second, Approx(sphere.volume));
+  }
+
+  TEST_CASE("Randomized") {
+    auto generator = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<Scalar>{-0.5, 4.5};
+    auto radius_dist = std::uniform_real_distribution<Scalar>{0.05, 1.5};
+
+    auto statistics = BoundsStatistics{};
+    for (auto idx = 0u; idx < 500u; ++idx) {
+      const auto sphere =
+          Sphere{{dist(generator), dist(generator), dist(generator)},
+                 radius_dist(generator)};
+
+      auto reference = Scalar{0};
+      for (const auto& hex : grid) {
+        reference = std::max(reference, overlap_volume(sphere, hex));
+      }
+
+      const auto owner =
+          overlap_owner(sphere, grid.begin(), grid.end(), &statistics);
+      CHECK_EQ(owner.second, reference);
+      if (reference > 0.0) {
+        REQUIRE(owner.first != grid.end());
+        CHECK_EQ(overlap_volume(sphere, *owner.first), owner.second);
+      }
+    }
+
+    CHECK_EQ(statistics.queries, 500u * grid.size());
+    CHECK_LT(statistics.exact_evaluations, statistics.queries / 10u);
+  }
+}
@@ -0,0 +1,141 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include "common.hpp"
+
+#include "overlap/overlap.hpp"
+
+#include <array>
+#include <random>
+
+TEST_SUITE("OverlapRadialIntegral") {
+  using namespace overlap;
+
+  // clang-format off
+  const auto hex = Hexahedron{{{
+      {-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1},
+      {-1, -1,  1}, {1, -1,  1}, {1, 1,  1}, {-1, 1,  1}}}};
+  // clang-format on
+
+  const auto tet =
+      Tetrahedron{{{{-1, -1, -1}, {1, -1, -1}, {0, 1, -1}, {0, 0, 1}}}};
+
+  // Lucy kernel (1 + 3 q) (1 - q)^3 without normalization
+  const auto lucy = std::array<Scalar, 5>{1, 0, -6, 8, -3};
+
+  // integral of the kernel over the full sphere
+  template<std::size_t N>
+  auto sphere_integral(const Sphere& sphere,
+                       const std::array<Scalar, N>& coefficients) -> Scalar {
+    auto result = Scalar{0};
+    for (auto k = 0u; k < N; ++k) {
+      result += coefficients[k] / Scalar(k + 3);
+    }
+
+    return 4.0 * detail::pi * sphere.radius * sphere.radius * sphere.radius *
+           result;
+  }
+
+  // reference based on the integration of the kernel times the area of the
+  // sphere of radius s inside the element over s using Simpson's rule
+  template<typename Element, std::size_t N>
+  auto simpson_integral(const Sphere& sphere, const Element& element,
+                        const std::array<Scalar, N>& coefficients) -> Scalar {
+    constexpr auto intervals = 2000u;
+    const auto h = sphere.radius / intervals;
+
+    auto result = Scalar{0};
+    for (auto idx = 1u; idx <= intervals; ++idx) {
+      const auto s = idx * h;
+      const auto q = s / sphere.radius;
+
+      auto kernel = Scalar{0};
+      auto q_power = Scalar{1};
+      for (auto k = 0u; k < N; ++k) {
+        kernel += coefficients[k] * q_power;
+        q_power *= q;
+      }
+
+      const auto weight = idx == intervals ? 1.0 : (idx % 2 == 1 ? 4.0 : 2.0);
+      result += weight * kernel *
+                overlap_area(Sphere{sphere.center, s}, element)[0];
+    }
+
+    return result * h / 3.0;
+  }
+
+  TEST_CASE("TrivialCases") {
+    CHECK_EQ(overlap_radial_integral(Sphere{{5, 0, 0}, 1}, hex, lucy), 0.0);
+
+    // sphere inside the element
+    const auto sphere = Sphere{{0.2, -0.1, 0.3}, 0.5};
+    CHECK_EQ(overlap_radial_integral(sphere, hex, lucy),
+             Approx(sphere_integral(sphere, lucy)));
+
+    // element inside the sphere: the integral of |x|^2 over the cube is 8
+    const auto large = Sphere{{0, 0, 0}, 4};
+    const auto square = std::array<Scalar, 3>{0, 0, 1};
+    CHECK_EQ(overlap_radial_integral(large, hex, square), Approx(8.0 / 16.0));
+  }
+
+  TEST_CASE("Volume") {
+    auto generator = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<Scalar>{-1.5, 1.5};
+
+    for (auto idx = 0u; idx < 1000u; ++idx) {
+      const auto sphere =
+          Sphere{{dist(generator), dist(generator), dist(generator)},
+                 0.2 + std::abs(dist(generator))};
+
+      CHECK_EQ(overlap_radial_integral(sphere, hex, std::array<Scalar, 1>{1}),
+               Approx(overlap_volume(sphere, hex)).epsilon(1e-10));
+    }
+  }
+
+  TEST_CASE("Hemisphere") {
+    const auto sphere = Sphere{{1, 0.2, 0}, 0.5};
+
+    CHECK_EQ(overlap_radial_integral(sphere, hex, lucy),
+             Approx(0.5 * sphere_integral(sphere, lucy)));
+  }
+
+  TEST_CASE("Decomposition") {
+    auto tets = std::array<Tetrahedron, 6>{};
+    detail::decompose(hex, tets);
+
+    auto generator = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<Scalar>{-1.5, 1.5};
+
+    for (auto idx = 0u; idx < 1000u; ++idx) {
+      const auto sphere =
+          Sphere{{dist(generator), dist(generator), dist(generator)},
+                 0.2 + std::abs(dist(generator))};
+
+      auto reference = Scalar{0};
+      for (const auto& t : tets) {
+        reference += overlap_radial_integral(sphere, t, lucy);
+      }
+
+      CHECK_EQ(overlap_radial_integral(sphere, hex, lucy),
+               Approx(reference).epsilon(1e-10).scale(1.0));
+    }
+  }
+
+  TEST_CASE("Quadrature") {
+    const auto spheres = std::array<Sphere, 4>{{{{0.9, 0.8, 0.7}, 0.6},
+                                                {{-0.5, 0.9, 1.1}, 0.8},
+                                                {{0.1, -0.2, -0.6}, 1.2},
+                                                {{0.3, 0.1, 0.2}, 2.5}}};
+
+    for (const auto& sphere : spheres) {
+      CHECK_EQ(overlap_radial_integral(sphere, hex, lucy),
+               Approx(simpson_integral(sphere, hex, lucy)).epsilon(1e-6));
+      CHECK_EQ(overlap_radial_integral(sphere, tet, lucy),
+               Approx(simpson_integral(sphere, tet, lucy)).epsilon(1e-6));
+    }
+  }
+}
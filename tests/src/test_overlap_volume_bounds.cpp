@@ -0,0 +1,114 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include "common.hpp"
+
+#include "overlap/overlap.hpp"
+
+#include <random>
+
+TEST_SUITE("OverlapVolumeBounds") {
+  using namespace overlap;
+
+  // clang-format off
+  const auto hex = Hexahedron{{{
+      {-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1},
+      {-1, -1,  1}, {1, -1,  1}, {1, 1,  1}, {-1, 1,  1}}}};
+
+  const auto wedge = Wedge{{{
+      {-1, -1, -1}, {1, -1, -1}, {0, 1, -1},
+      {-1, -1,  1}, {1, -1,  1}, {0, 1,  1}}}};
+  // clang-format on
+
+  const auto tet =
+      Tetrahedron{{{{-1, -1, -1}, {1, -1, -1}, {0, 1, -1}, {0, 0, 1}}}};
+
+  template<typename Element>
+  void check_bounds(const Sphere& sphere, const Element& element) {
+    const auto bounds = overlap_volume_bounds(sphere, element);
+    const auto volume = overlap_volume(sphere, element);
+
+    CHECK_LE(bounds.lower, bounds.upper);
+    CHECK_LE(bounds.lower, volume);
+    CHECK_GE(bounds.upper, volume);
+  }
+
+  TEST_CASE("TrivialCases") {
+    const auto far = overlap_volume_bounds(Sphere{{5, 0, 0}, 1}, hex);
+    CHECK_EQ(far.lower, 0.0);
+    CHECK_EQ(far.upper, 0.0);
+
+    const auto large = overlap_volume_bounds(Sphere{{0, 0, 0}, 2}, hex);
+    CHECK_EQ(large.lower, hex.volume);
+    CHECK_EQ(large.upper, hex.volume);
+
+    // sphere inside the element
+    const auto sphere = Sphere{{0.2, -0.1, 0.3}, 0.5};
+    const auto small = overlap_volume_bounds(sphere, hex);
+    CHECK_EQ(small.lower, Approx(sphere.volume));
+    CHECK_EQ(small.upper, Approx(sphere.volume));
+  }
+
+  TEST_CASE("Hemisphere") {
+    // a single cap beyond one face plane is exact
+    const auto sphere = Sphere{{1, 0.2, 0}, 0.5};
+    const auto bounds = overlap_volume_bounds(sphere, hex);
+
+    CHECK_EQ(bounds.lower, Approx(0.5 * sphere.volume));
+    CHECK_EQ(bounds.upper, Approx(0.5 * sphere.volume));
+  }
+
+  TEST_CASE("Randomized") {
+    auto generator = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<Scalar>{-2, 2};
+
+    for (auto idx = 0u; idx < 2000u; ++idx) {
+      const auto sphere =
+          Sphere{{dist(generator), dist(generator), dist(generator)},
+                 0.1 + std::abs(dist(generator))};
+
+      check_bounds(sphere, hex);
+      check_bounds(sphere, wedge);
+      check_bounds(sphere, tet);
+    }
+  }
+
+  TEST_CASE("Exceeds") {
+    auto generator = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<Scalar>{-2, 2};
+
+    auto statistics = BoundsStatistics{};
+    for (auto idx = 0u; idx < 2000u; ++idx) {
+      const auto sphere =
+          Sphere{{dist(generator), dist(generator), dist(generator)},
+                 0.1 + std::abs(dist(generator))};
+
+      for (const auto fraction : {0.01, 0.5, 0.99}) {
+        const auto threshold = fraction * hex.volume;
+        CHECK_EQ(overlap_exceeds(sphere, hex, threshold, &statistics),
+                 overlap_volume(sphere, hex) > threshold);
+      }
+    }
+
+    CHECK_EQ(statistics.queries, 6000u);
+    CHECK_GT(statistics.exact_evaluations, 0u);
+    CHECK_LT(statistics.exact_evaluations, statistics.queries);
+    CHECK(statistics.exact_rate() ==
+          Approx(static_cast<Scalar>(statistics.exact_evaluations) / 6000.0));
+  }
+
+  TEST_CASE("Statistics") {
+    auto a = BoundsStatistics{10u, 2u};
+    const auto b = BoundsStatistics{30u, 6u};
+    a += b;
+
+    CHECK_EQ(a.queries, 40u);
+    CHECK_EQ(a.exact_evaluations, 8u);
+    CHECK(a.exact_rate() == Approx(0.2));
+    CHECK_EQ(BoundsStatistics{}.exact_rate(), Scalar{0});
+  }
+}
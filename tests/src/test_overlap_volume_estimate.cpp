@@ -0,0 +1,130 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include "common.hpp"
+
+#include "overlap/overlap.hpp"
+
+#include <limits>
+
+TEST_SUITE("overlap_volume_estimate") {
+  using namespace overlap;
+
+  TEST_CASE("TrivialCases") {
+    const auto hex = unit_hexahedron();
+
+    SUBCASE("Disjoint") {
+      const auto estimate = overlap_volume_estimate(Sphere{{5, 0, 0}, 1}, hex);
+      CHECK_EQ(estimate.volume, Scalar{0});
+      CHECK_EQ(estimate.error_estimate, Scalar{0});
+    }
+
+    SUBCASE("HexInSphere") {
+      const auto estimate = overlap_volume_estimate(Sphere{{0, 0, 0}, 2}, hex);
+      CHECK_EQ(estimate.volume, hex.volume);
+      CHECK_EQ(estimate.error_estimate, Scalar{0});
+    }
+
+    SUBCASE("SphereInHex") {
+      const auto sphere = Sphere{{0, 0, 0}, 0.5};
+      const auto estimate = overlap_volume_estimate(sphere, hex);
+      CHECK_EQ(estimate.volume, sphere.volume);
+      CHECK_EQ(estimate.error_estimate, Scalar{0});
+    }
+  }
+
+  // For these well-conditioned configurations, the estimate has to agree with
+  // the robust calculation within the estimated error.
+  TEST_CASE("ErrorEstimate") {
+    const auto hex = unit_hexahedron();
+    const auto tet = Tetrahedron{
+        {{{-1, -1, -1}, {1, -1, -1}, {-1, 1, -1}, {-1, -1, 1}}}};
+
+    const auto radii = {0.3, 0.75, 1.0, 1.4};
+    for (const auto radius : radii) {
+      for (auto i = 0; i < 7; ++i) {
+        for (auto j = 0; j < 7; ++j) {
+          for (auto k = 0; k < 7; ++k) {
+            const auto center = Vector{-1.6 + 0.55 * i, -1.55 + 0.5 * j,
+                                       -1.45 + 0.45 * k};
+
+            const auto sphere = Sphere{center, radius};
+            CAPTURE(center);
+            CAPTURE(radius);
+
+            const auto hex_estimate = overlap_volume_estimate(sphere, hex);
+            CHECK(std::abs(hex_estimate.volume - overlap_volume(sphere, hex)) <=
+                  hex_estimate.error_estimate);
+            CHECK(hex_estimate.error_estimate < 1e-10);
+
+            const auto tet_estimate = overlap_volume_estimate(sphere, tet);
+            CHECK(std::abs(tet_estimate.volume - overlap_volume(sphere, tet)) <=
+                  tet_estimate.error_estimate);
+          }
+        }
+      }
+    }
+  }
+
+  // Sphere centered very close to an edge, requiring the re-orthonormalization
+  // of the robust calculation.
+  TEST_CASE("NearlyDegenerateWedge") {
+    const auto hex = unit_hexahedron();
+    const auto sphere = Sphere{Vector{1, 1 + 1e-12, 0.5}, 0.25};
+
+    const auto estimate = overlap_volume_estimate(sphere, hex);
+    CHECK(estimate.error_estimate > 1e-12);
+
+    auto statistics = FallbackStatistics{};
+    const auto volume =
+        overlap_volume_adaptive(sphere, hex, 1e-12, &statistics);
+
+    CHECK_EQ(volume, overlap_volume(sphere, hex));
+    CHECK_EQ(statistics.evaluations, 1u);
+    CHECK_EQ(statistics.fallbacks, 1u);
+  }
+
+  TEST_CASE("Adaptive") {
+    const auto hex = unit_hexahedron();
+    const auto spheres = {Sphere{{0, 0, 1}, 0.5}, Sphere{{0, -1, 1}, 0.75},
+                          Sphere{{1, 1, 1}, 1.2}, Sphere{{0.3, 0.2, 0.1}, 1.5}};
+
+    auto statistics = FallbackStatistics{};
+    for (const auto& sphere : spheres) {
+      const auto tolerance = 1e-12 * sphere.volume;
+      const auto volume =
+          overlap_volume_adaptive(sphere, hex, tolerance, &statistics);
+
+      CHECK(volume == Approx(overlap_volume(sphere, hex)).epsilon(tolerance));
+    }
+
+    CHECK_EQ(statistics.evaluations, spheres.size());
+    CHECK_EQ(statistics.fallbacks, 0u);
+    CHECK_EQ(statistics.fallback_rate(), Scalar{0});
+
+    // a zero tolerance enforces the robust calculation for all cut elements
+    for (const auto& sphere : spheres) {
+      overlap_volume_adaptive(sphere, hex, Scalar{0}, &statistics);
+    }
+
+    CHECK_EQ(statistics.evaluations, 2 * spheres.size());
+    CHECK_EQ(statistics.fallbacks, spheres.size());
+    CHECK(statistics.fallback_rate() == Approx(0.5));
+  }
+
+  TEST_CASE("CombineStatistics") {
+    auto a = FallbackStatistics{10u, 2u};
+    const auto b = FallbackStatistics{30u, 6u};
+
+    a += b;
+
+    CHECK_EQ(a.evaluations, 40u);
+    CHECK_EQ(a.fallbacks, 8u);
+    CHECK(a.fallback_rate() == Approx(0.2));
+    CHECK_EQ(FallbackStatistics{}.fallback_rate(), Scalar{0});
+  }
+}
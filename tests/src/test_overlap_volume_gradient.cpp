@@ -0,0 +1,126 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include "common.hpp"
+
+#include "overlap/overlap.hpp"
+
+#include <random>
+
+TEST_SUITE("OverlapVolumeGradient") {
+  using namespace overlap;
+
+  // clang-format off
+  const auto hex = Hexahedron{{{
+      {-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1},
+      {-1, -1,  1}, {1, -1,  1}, {1, 1,  1}, {-1, 1,  1}}}};
+  // clang-format on
+
+  // central differences of the overlap volume
+  template<typename Element>
+  auto finite_differences(const Sphere& sphere, const Element& element)
+      -> OverlapGradient {
+    constexpr auto h = Scalar{1e-6};
+
+    auto result = OverlapGradient{};
+    result.volume = overlap_volume(sphere, element);
+
+    for (auto dim = 0; dim < 3; ++dim) {
+      const auto offset = Vector{h * Vector::Unit(dim)};
+      result.center[dim] =
+          (overlap_volume(Sphere{sphere.center + offset, sphere.radius},
+                          element) -
+           overlap_volume(Sphere{sphere.center - offset, sphere.radius},
+                          element)) /
+          (Scalar{2} * h);
+    }
+
+    result.radius =
+        (overlap_volume(Sphere{sphere.center, sphere.radius + h}, element) -
+         overlap_volume(Sphere{sphere.center, sphere.radius - h}, element)) /
+        (Scalar{2} * h);
+
+    return result;
+  }
+
+  template<typename Element>
+  void check_gradient(const Sphere& sphere, const Element& element) {
+    const auto gradient = overlap_volume_gradient(sphere, element);
+    const auto reference = finite_differences(sphere, element);
+
+    CHECK_EQ(gradient.volume, Approx(reference.volume));
+    CHECK_EQ(gradient.radius, Approx(reference.radius).epsilon(1e-5));
+
+    // the derivative w.r.t. the radius is the surface area of the sphere
+    // inside the element
+    CHECK_EQ(gradient.radius,
+             Approx(overlap_area(sphere, element)[0]).epsilon(1e-10));
+    for (auto dim = 0; dim < 3; ++dim) {
+      CHECK_EQ(gradient.center[dim],
+               Approx(reference.center[dim]).epsilon(1e-5).scale(1.0));
+    }
+  }
+
+  TEST_CASE("TrivialCases") {
+    // disjoint
+    const auto far = overlap_volume_gradient(Sphere{{5, 0, 0}, 1}, hex);
+    CHECK_EQ(far.volume, 0.0);
+    CHECK_EQ(far.radius, 0.0);
+    CHECK(far.center.isZero());
+
+    // element inside the sphere
+    const auto large = overlap_volume_gradient(Sphere{{0, 0, 0}, 5}, hex);
+    CHECK_EQ(large.volume, Approx(hex.volume));
+    CHECK_EQ(large.radius, 0.0);
+    CHECK(large.center.isZero());
+
+    // sphere inside the element
+    const auto sphere = Sphere{{0.2, 0, 0}, 0.5};
+    const auto small = overlap_volume_gradient(sphere, hex);
+    CHECK_EQ(small.volume, Approx(sphere.volume));
+    CHECK_EQ(small.radius, Approx(sphere.surface_area()));
+    CHECK(small.center.isZero());
+  }
+
+  TEST_CASE("Face") {
+    // sphere centered on the face at x = 1: moving the sphere in -x direction
+    // increases the overlap at the rate of the area of the disk
+    const auto sphere = Sphere{{1, 0, 0}, 0.5};
+    const auto gradient = overlap_volume_gradient(sphere, hex);
+    const auto disk_area = detail::pi * sphere.radius * sphere.radius;
+
+    CHECK_EQ(gradient.volume, Approx(Scalar{0.5} * sphere.volume));
+    CHECK_EQ(gradient.radius, Approx(Scalar{0.5} * sphere.surface_area()));
+    CHECK_EQ(gradient.center[0], Approx(-disk_area));
+    CHECK_EQ(gradient.center[1], Approx(0.0).scale(1.0));
+    CHECK_EQ(gradient.center[2], Approx(0.0).scale(1.0));
+  }
+
+  TEST_CASE("Randomized") {
+    const auto tet = Tetrahedron{
+        {{{-1, -1, -1}, {1, -1, -1}, {0, 1, -1}, {0, 0, 1}}}};
+
+    const auto pyramid = Pyramid{
+        {{{-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1}, {0, 0, 1}}}};
+
+    auto generator = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<Scalar>{-1.5, 1.5};
+
+    for (auto idx = 0u; idx < 1000u; ++idx) {
+      const auto sphere =
+          Sphere{{dist(generator), dist(generator), dist(generator)},
+                 0.2 + std::abs(dist(generator))};
+
+      check_gradient(sphere, hex);
+      check_gradient(sphere, tet);
+      check_gradient(sphere, pyramid);
+    }
+
+    // sphere containing the apex of the pyramid
+    check_gradient(Sphere{{0.1, 0, 0.8}, 0.5}, pyramid);
+  }
+}
@@ -0,0 +1,74 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include "common.hpp"
+
+#include "overlap/overlap.hpp"
+
+#include <vector>
+
+TEST_SUITE("overlap_volume_pairs") {
+  using namespace overlap;
+
+  TEST_CASE("ContainsSphere") {
+    const auto hex = unit_hexahedron();
+
+    CHECK(detail::contains(hex, Sphere{Vector::Zero(), 0.5}));
+    CHECK(detail::contains(hex, Sphere{Vector::Zero(), 1.0}));
+    CHECK_FALSE(detail::contains(hex, Sphere{Vector::Zero(), 1.01}));
+    CHECK_FALSE(detail::contains(hex, Sphere{{0.75, 0, 0}, 0.5}));
+  }
+
+  TEST_CASE("MixedBatch") {
+    const auto elements = std::vector<Hexahedron>{
+        unit_hexahedron(), unit_hexahedron(0.5), unit_hexahedron(2.0)};
+
+    const auto spheres = std::vector<Sphere>{
+        {{5, 0, 0}, 1},          // disjoint from all elements
+        {Vector::Zero(), 0.25},  // contained in all elements
+        {Vector::Zero(), 1.5},   // contains the smaller elements
+        {{1, 1, 1}, 1},          // intersects the unit hexahedron at a vertex
+        {{0, -1, 1}, 0.75},      // intersects the unit hexahedron at an edge
+    };
+
+    auto pairs = std::vector<SphereElementPair>{};
+    for (auto element_idx = 0u; element_idx < elements.size(); ++element_idx) {
+      for (auto sphere_idx = 0u; sphere_idx < spheres.size(); ++sphere_idx) {
+        pairs.emplace_back(sphere_idx, element_idx);
+      }
+    }
+
+    auto statistics = PipelineStatistics{};
+    const auto results =
+        overlap_volume_pairs(spheres, elements, pairs, &statistics);
+
+    REQUIRE_EQ(results.size(), pairs.size());
+    for (auto pair_idx = 0u; pair_idx < pairs.size(); ++pair_idx) {
+      const auto& sphere = spheres[pairs[pair_idx].first];
+      const auto& element = elements[pairs[pair_idx].second];
+
+      CHECK_EQ(results[pair_idx], overlap_volume(sphere, element));
+    }
+
+    CHECK_EQ(statistics.pairs, pairs.size());
+    CHECK_EQ(statistics.coarse_survivors, pairs.size() - elements.size());
+    CHECK_LT(statistics.exact_pairs, statistics.coarse_survivors);
+    CHECK_GT(statistics.exact_pairs, 0u);
+
+    // the statistics accumulate over multiple batches
+    overlap_volume_pairs(spheres, elements, pairs, &statistics);
+    CHECK_EQ(statistics.pairs, 2 * pairs.size());
+  }
+
+  TEST_CASE("EmptyBatch") {
+    const auto results = overlap_volume_pairs(
+        std::vector<Sphere>{}, std::vector<Tetrahedron>{},
+        std::vector<SphereElementPair>{});
+
+    CHECK(results.empty());
+  }
+}
@@ -0,0 +1,140 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include "common.hpp"
+
+#include "overlap/overlap.hpp"
+
+#include <array>
+#include <random>
+
+TEST_SUITE("OverlapVolumeVertexGradient") {
+  using namespace overlap;
+
+  constexpr auto h = Scalar{1e-6};
+
+  // clang-format off
+  const auto hex = Hexahedron{{{
+      {-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1},
+      {-1, -1,  1}, {1, -1,  1}, {1, 1,  1}, {-1, 1,  1}}}};
+  // clang-format on
+
+  const auto tet =
+      Tetrahedron{{{{-1, -1, -1}, {1, -1, -1}, {0, 1, -1}, {0, 0, 1}}}};
+
+  TEST_CASE("DiskPolygonMoments") {
+    const auto square =
+        std::array<detail::Vector2, 4>{{{-1, -1}, {1, -1}, {1, 1}, {-1, 1}}};
+
+    // disk inside the polygon, polar moment pi r^4 / 2
+    const auto disk = detail::disk_polygon_moments(square, 0.5);
+    CHECK_EQ(disk.area, Approx(detail::pi * 0.25));
+    CHECK_EQ(disk.first.norm(), Approx(0.0).scale(1.0));
+    CHECK_EQ(disk.polar, Approx(0.5 * detail::pi * 0.0625));
+
+    // polygon inside the disk
+    const auto inner = detail::disk_polygon_moments(square, 2.0);
+    CHECK_EQ(inner.area, Approx(4.0));
+    CHECK_EQ(inner.first.norm(), Approx(0.0).scale(1.0));
+    CHECK_EQ(inner.polar, Approx(8.0 / 3.0));
+
+    // half disk: the centroid is located at 4 r / (3 pi)
+    const auto half =
+        std::array<detail::Vector2, 4>{{{0, -2}, {2, -2}, {2, 2}, {0, 2}}};
+    const auto half_disk = detail::disk_polygon_moments(half, 1.0);
+    CHECK_EQ(half_disk.area, Approx(0.5 * detail::pi));
+    CHECK_EQ(half_disk.first[0] / half_disk.area,
+             Approx(4.0 / (3.0 * detail::pi)));
+    CHECK_EQ(half_disk.first[1], Approx(0.0).scale(1.0));
+    CHECK_EQ(half_disk.polar, Approx(0.25 * detail::pi));
+  }
+
+  TEST_CASE("Tetrahedron") {
+    auto generator = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<Scalar>{-1.5, 1.5};
+
+    for (auto sample = 0u; sample < 200u; ++sample) {
+      const auto sphere =
+          Sphere{{dist(generator), dist(generator), dist(generator)},
+                 0.2 + std::abs(dist(generator))};
+
+      const auto gradient = overlap_volume_vertex_gradient(sphere, tet);
+
+      // central differences w.r.t. every vertex coordinate
+      for (auto vertex_idx = 0u; vertex_idx < 4u; ++vertex_idx) {
+        for (auto dim = 0; dim < 3; ++dim) {
+          auto vertices = tet.vertices;
+          vertices[vertex_idx][dim] += h;
+          const auto forward = overlap_volume(sphere, Tetrahedron{vertices});
+
+          vertices[vertex_idx][dim] -= Scalar{2} * h;
+          const auto backward = overlap_volume(sphere, Tetrahedron{vertices});
+
+          CHECK_EQ(gradient[vertex_idx][dim],
+                   Approx((forward - backward) / (Scalar{2} * h))
+                       .epsilon(1e-5)
+                       .scale(1.0));
+        }
+      }
+    }
+  }
+
+  TEST_CASE("Hexahedron") {
+    auto generator = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<Scalar>{-1.5, 1.5};
+
+    for (auto sample = 0u; sample < 200u; ++sample) {
+      const auto sphere =
+          Sphere{{dist(generator), dist(generator), dist(generator)},
+                 0.2 + std::abs(dist(generator))};
+
+      const auto gradient = overlap_volume_vertex_gradient(sphere, hex);
+
+      // translating the element is equivalent to moving the sphere in the
+      // opposite direction
+      auto sum = Vector{Vector::Zero()};
+      for (const auto& vertex_gradient : gradient) {
+        sum += vertex_gradient;
+      }
+
+      const auto center_gradient = overlap_volume_gradient(sphere, hex).center;
+      for (auto dim = 0; dim < 3; ++dim) {
+        CHECK_EQ(sum[dim], Approx(-center_gradient[dim]).scale(1.0));
+      }
+
+      // moving the top face keeps all faces planar
+      auto vertices = hex.vertices;
+      for (auto vertex_idx = 4u; vertex_idx < 8u; ++vertex_idx) {
+        vertices[vertex_idx][2] += h;
+      }
+      const auto forward = overlap_volume(sphere, Hexahedron{vertices});
+
+      for (auto vertex_idx = 4u; vertex_idx < 8u; ++vertex_idx) {
+        vertices[vertex_idx][2] -= Scalar{2} * h;
+      }
+      const auto backward = overlap_volume(sphere, Hexahedron{vertices});
+
+      const auto top_gradient =
+          gradient[4][2] + gradient[5][2] + gradient[6][2] + gradient[7][2];
+      CHECK_EQ(top_gradient, Approx((forward - backward) / (Scalar{2} * h))
+                                 .epsilon(1e-5)
+                                 .scale(1.0));
+    }
+  }
+
+  TEST_CASE("ContainedElement") {
+    // the derivatives of the volume of the element: moving a vertex of the
+    // cube outwards along the diagonal grows the three adjacent faces
+    const auto gradient = overlap_volume_vertex_gradient(Sphere{{0, 0, 0}, 5},
+                                                         hex);
+
+    for (auto dim = 0; dim < 3; ++dim) {
+      CHECK_EQ(gradient[6][dim], Approx(1.0));
+      CHECK_EQ(gradient[0][dim], Approx(-1.0));
+    }
+  }
+}
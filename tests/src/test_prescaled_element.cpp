@@ -0,0 +1,113 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include "common.hpp"
+
+#include "overlap/overlap.hpp"
+
+#include <random>
+#include <vector>
+
+TEST_SUITE("PrescaledElement") {
+  using namespace overlap;
+
+  // clang-format off
+  const auto hex = Hexahedron{{{
+      {-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1},
+      {-1, -1,  1}, {1, -1,  1}, {1, 1,  1}, {-1, 1,  1},
+  }}};
+  // clang-format on
+
+  const auto tet = Tetrahedron{Vector{-1, -1, -1}, Vector{1, -1, -1},
+                               Vector{0, 1, -1}, Vector{0, 0, 1}};
+
+  const auto wedge = Wedge{Vector{-1, -1, -1}, Vector{1, -1, -1},
+                           Vector{0, 1, -1},   Vector{-1, -1, 1},
+                           Vector{1, -1, 1},   Vector{0, 1, 1}};
+
+  const auto pyramid =
+      Pyramid{Vector{-1, -1, -1}, Vector{1, -1, -1}, Vector{1, 1, -1},
+              Vector{-1, 1, -1}, Vector{0, 0, 1}};
+
+  TEST_CASE("Translation") {
+    // a pure translation leaves areas and volume unchanged
+    auto translated = hex;
+    translated.apply(detail::Transformation{Vector{0.1, 0.2, 0.3}, 1});
+
+    CHECK_EQ(translated.volume, hex.volume);
+    for (auto face_idx = 0u; face_idx < hex.faces.size(); ++face_idx) {
+      CHECK_EQ(translated.faces[face_idx].area, hex.faces[face_idx].area);
+      CHECK(translated.faces[face_idx].normal == hex.faces[face_idx].normal);
+    }
+  }
+
+  TEST_CASE_TEMPLATE("Monodisperse", Element, Tetrahedron, Wedge, Hexahedron,
+                     Pyramid) {
+    const auto element = [&]() -> Element {
+      if constexpr (std::is_same_v<Element, Tetrahedron>) {
+        return tet;
+      } else if constexpr (std::is_same_v<Element, Wedge>) {
+        return wedge;
+      } else if constexpr (std::is_same_v<Element, Hexahedron>) {
+        return hex;
+      } else {
+        return pyramid;
+      }
+    }();
+
+    constexpr auto radius = 0.7;
+    const auto prescaled = PrescaledElement<Element>{element, radius};
+
+    CHECK_EQ(prescaled.volume(), element.volume);
+    CHECK_EQ(prescaled.scaled().volume,
+             Approx(element.volume / (radius * radius * radius)));
+
+    auto generator = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<Scalar>{-2.0, 2.0};
+
+    for (auto idx = 0u; idx < 1000u; ++idx) {
+      const auto sphere = Sphere{
+          {dist(generator), dist(generator), dist(generator)}, radius};
+
+      CHECK_EQ(overlap_volume(sphere, prescaled),
+               Approx(overlap_volume(sphere, element)).epsilon(1e-12));
+    }
+  }
+
+  TEST_CASE("Bucketed") {
+    auto generator = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<Scalar>{-2.0, 2.0};
+
+    // a few distinct radii, spheres in random order
+    const auto radii = std::vector<Scalar>{0.3, 0.8, 1.5};
+
+    auto spheres = std::vector<Sphere>{};
+    auto pairs = std::vector<SphereElementPair>{};
+    for (auto idx = 0u; idx < 300u; ++idx) {
+      spheres.emplace_back(
+          Vector{dist(generator), dist(generator), dist(generator)},
+          radii[idx % radii.size()]);
+      pairs.emplace_back(idx, idx % 2u);
+    }
+
+    auto moved = hex;
+    moved.apply(detail::Transformation{Vector{0.5, 0, 0}, 1});
+    const auto elements = std::vector<Hexahedron>{hex, moved};
+
+    const auto results =
+        overlap_volume_pairs_bucketed(spheres, elements, pairs);
+    REQUIRE_EQ(results.size(), pairs.size());
+
+    for (auto pair_idx = 0u; pair_idx < pairs.size(); ++pair_idx) {
+      const auto& [sphere_idx, element_idx] = pairs[pair_idx];
+      CHECK_EQ(results[pair_idx],
+               Approx(overlap_volume(spheres[sphere_idx],
+                                     elements[element_idx]))
+                   .epsilon(1e-12));
+    }
+  }
+}
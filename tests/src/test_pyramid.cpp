@@ -0,0 +1,109 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include "common.hpp"
+
+#include "overlap/overlap.hpp"
+
+#include <array>
+#include <random>
+
+TEST_SUITE("Pyramid") {
+  using namespace overlap;
+
+  // square base with a side length of 2, apex at a height of 1
+  const auto pyramid = Pyramid{Vector{-1, -1, 0}, Vector{1, -1, 0},
+                               Vector{1, 1, 0}, Vector{-1, 1, 0},
+                               Vector{0, 0, 1}};
+
+  // reference result based on the decomposition into two tetrahedra
+  const auto decomposed_volume = [](const Sphere& sphere) {
+    auto tets = std::array<Tetrahedron, 2>{};
+    detail::decompose(pyramid, tets);
+
+    return overlap_volume(sphere, tets[0]) + overlap_volume(sphere, tets[1]);
+  };
+
+  TEST_CASE("Element") {
+    CHECK_EQ(pyramid.volume, Approx(4.0 / 3.0));
+    CHECK(pyramid.center.isApprox(Vector{0, 0, 0.2}));
+    CHECK_EQ(pyramid.surface_area(), Approx(4.0 + 4.0 * std::sqrt(2.0)));
+
+    CHECK(pyramid.faces[0].normal.isApprox(Vector{0, 0, -1}));
+    for (auto face_idx = 1u; face_idx < 5u; ++face_idx) {
+      const auto& face = pyramid.faces[face_idx];
+      CHECK_GT(face.normal.dot(face.center - pyramid.center), 0.0);
+      CHECK_EQ(face.area, Approx(std::sqrt(2.0)));
+    }
+
+    CHECK_EQ(detail::num_vertices<Pyramid>(), 5u);
+    CHECK_EQ(detail::num_edges<Pyramid>(), 8u);
+    CHECK_EQ(detail::num_faces<Pyramid>(), 5u);
+  }
+
+  TEST_CASE("TrivialCases") {
+    CHECK_EQ(overlap_volume(Sphere{{5, 0, 0}, 1}, pyramid), 0.0);
+    CHECK_EQ(overlap_volume(Sphere{Vector::Zero(), 10}, pyramid),
+             Approx(pyramid.volume));
+
+    const auto sphere = Sphere{{0, 0, 0.3}, 0.1};
+    CHECK_EQ(overlap_volume(sphere, pyramid), Approx(sphere.volume));
+  }
+
+  TEST_CASE("Apex") {
+    // The solid angle at the apex is 4 * asin(sin(pi / 4)^2) = 2 * pi / 3, so
+    // one sixth of the sphere overlaps the pyramid.
+    const auto sphere = Sphere{{0, 0, 1}, 0.25};
+
+    CHECK_EQ(overlap_volume(sphere, pyramid), Approx(sphere.volume / 6.0));
+
+    const auto area = overlap_area(sphere, pyramid);
+    CHECK_EQ(area[0], Approx(sphere.surface_area() / 6.0));
+    CHECK_EQ(area[1], 0.0);
+    for (auto face_idx = 1u; face_idx < 5u; ++face_idx) {
+      // circular sector with the angle acos(1 / 3) at the apex
+      CHECK_EQ(area[face_idx + 1],
+               Approx(0.5 * 0.25 * 0.25 * std::acos(1.0 / 3.0)));
+    }
+
+    CHECK_EQ(area.back(),
+             Approx(std::accumulate(area.begin() + 1, area.end() - 1, 0.0)));
+
+    const auto estimate = overlap_volume_estimate(sphere, pyramid);
+    CHECK_EQ(estimate.volume, Approx(sphere.volume / 6.0));
+    CHECK_LT(estimate.error_estimate, 1e-10);
+  }
+
+  TEST_CASE("BaseVertex") {
+    // the corner of the base is formed by three faces
+    const auto sphere = Sphere{{-1, -1, 0}, 0.25};
+
+    CHECK_EQ(overlap_volume(sphere, pyramid),
+             Approx(decomposed_volume(sphere)));
+  }
+
+  TEST_CASE("Randomized") {
+    auto generator = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<Scalar>{-1.5, 1.5};
+
+    for (auto idx = 0u; idx < 1000u; ++idx) {
+      const auto sphere = Sphere{{dist(generator), dist(generator),
+                                  0.5 + 0.5 * dist(generator)},
+                                 0.1 + 0.5 * std::abs(dist(generator))};
+
+      CHECK_EQ(overlap_volume(sphere, pyramid),
+               Approx(decomposed_volume(sphere)).epsilon(1e-10));
+
+      CHECK_EQ(overlap_volume(sphere, CompactPyramid{pyramid}),
+               Approx(overlap_volume(sphere, pyramid)));
+
+      const auto area = overlap_area(sphere, pyramid);
+      CHECK_EQ(area.back(), Approx(std::accumulate(area.begin() + 1,
+                                                   area.end() - 1, 0.0)));
+    }
+  }
+}
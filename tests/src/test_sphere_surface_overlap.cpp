@@ -0,0 +1,159 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include "common.hpp"
+
+#include "overlap/overlap.hpp"
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+TEST_SUITE("SphereSurfaceOverlap") {
+  using namespace overlap;
+
+  using Triangles = std::vector<std::array<Vector, 3>>;
+
+  // Closed surface of a set of unit voxels, consisting of all faces not shared
+  // by two voxels of the set.
+  const auto voxel_surface = [](const std::vector<Vector>& voxels) {
+    const auto occupied = [&](const Vector& p) {
+      return std::any_of(voxels.begin(), voxels.end(),
+                         [&](const Vector& v) { return v.isApprox(p); });
+    };
+
+    auto triangles = Triangles{};
+    for (const auto& voxel : voxels) {
+      for (auto axis = 0; axis < 3; ++axis) {
+        const auto u = Vector::Unit((axis + 1) % 3);
+        const auto v = Vector::Unit((axis + 2) % 3);
+
+        for (const auto sign : {-1.0, 1.0}) {
+          if (occupied(voxel + sign * Vector::Unit(axis))) {
+            continue;
+          }
+
+          // counterclockwise w.r.t. the unit vector of the axis
+          const auto o =
+              (sign > 0.0 ? Vector{voxel + Vector::Unit(axis)} : voxel).eval();
+          auto quad = std::array<Vector, 4>{o, o + u, o + u + v, o + v};
+          if (sign < 0.0) {
+            std::swap(quad[1], quad[3]);
+          }
+
+          triangles.push_back({quad[0], quad[1], quad[2]});
+          triangles.push_back({quad[0], quad[2], quad[3]});
+        }
+      }
+    }
+
+    return triangles;
+  };
+
+  const auto voxel_volume = [](const Sphere& sphere,
+                               const std::vector<Vector>& voxels) {
+    auto volume = Scalar{0};
+    for (const auto& p : voxels) {
+      const auto hex = Hexahedron{
+          p + Vector{0, 0, 0}, p + Vector{1, 0, 0}, p + Vector{1, 1, 0},
+          p + Vector{0, 1, 0}, p + Vector{0, 0, 1}, p + Vector{1, 0, 1},
+          p + Vector{1, 1, 1}, p + Vector{0, 1, 1}};
+
+      volume += overlap_volume(sphere, hex);
+    }
+
+    return volume;
+  };
+
+  TEST_CASE("Cube") {
+    const auto voxels = std::vector<Vector>{Vector::Zero()};
+    const auto triangles = voxel_surface(voxels);
+    REQUIRE_EQ(triangles.size(), 12u);
+
+    CHECK_EQ(overlap_volume_surface(Sphere{{0.5, 0.5, 0.5}, 10}, triangles),
+             Approx(1.0));
+
+    const auto inner_sphere = Sphere{{0.5, 0.5, 0.5}, 0.25};
+    CHECK_EQ(overlap_volume_surface(inner_sphere, triangles),
+             Approx(inner_sphere.volume));
+
+    CHECK_EQ(overlap_volume_surface(Sphere{{5, 0, 0}, 1}, triangles), 0.0);
+
+    // the result is independent of the reference point, which may also be
+    // located outside of the body
+    const auto sphere = Sphere{{1, 1, 1}, 0.5};
+    for (const auto& reference :
+         {Vector{0.5, 0.5, 0.5}, Vector{-2, 3, 1}, Vector{1, 1, 1}}) {
+      CHECK_EQ(overlap_volume_surface(sphere, triangles, reference),
+               Approx(sphere.volume / 8.0));
+    }
+  }
+
+  TEST_CASE("NonConvex") {
+    // non-convex body made up of four voxels
+    const auto voxels =
+        std::vector<Vector>{{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 1, 1}};
+    const auto triangles = voxel_surface(voxels);
+
+    auto generator = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<Scalar>{-0.5, 2.5};
+
+    for (auto idx = 0u; idx < 200u; ++idx) {
+      const auto sphere =
+          Sphere{{dist(generator), dist(generator), dist(generator)},
+                 0.1 + 0.5 * std::abs(dist(generator))};
+
+      CHECK_EQ(overlap_volume_surface(sphere, triangles),
+               Approx(voxel_volume(sphere, voxels)).epsilon(1e-10));
+    }
+  }
+
+  TEST_CASE("LargeSurface") {
+    // slab of 6 x 6 x 2 voxels, the surface consists of enough triangles to
+    // be split across several threads if OpenMP is enabled
+    auto voxels = std::vector<Vector>{};
+    for (auto i = 0; i < 6; ++i) {
+      for (auto j = 0; j < 6; ++j) {
+        for (auto k = 0; k < 2; ++k) {
+          voxels.emplace_back(i, j, k);
+        }
+      }
+    }
+
+    const auto triangles = voxel_surface(voxels);
+    REQUIRE_EQ(triangles.size(), 240u);
+
+    auto generator = std::mt19937{42};
+    auto dist = std::uniform_real_distribution<Scalar>{-1.0, 7.0};
+
+    for (auto idx = 0u; idx < 50u; ++idx) {
+      const auto sphere =
+          Sphere{{dist(generator), dist(generator), 0.5 * dist(generator)},
+                 0.5 + 0.5 * std::abs(dist(generator))};
+
+      CHECK_EQ(overlap_volume_surface(sphere, triangles),
+               Approx(voxel_volume(sphere, voxels)).epsilon(1e-10));
+    }
+  }
+
+  TEST_CASE("DegenerateTriangles") {
+    // triangles coplanar with the reference point do not contribute
+    const auto sphere = Sphere{};
+    const auto triangle =
+        std::array<Vector, 3>{Vector{0, 0, 0}, Vector{1, 0, 0}, {0, 1, 0}};
+
+    CHECK_EQ(detail::signed_overlap_volume(sphere, triangle, {1, 1, 0}), 0.0);
+
+    // the sign depends on the side of the triangle the reference is located
+    CHECK_EQ(detail::signed_overlap_volume(sphere, triangle, {0, 0, -0.1}),
+             Approx(-detail::signed_overlap_volume(sphere, triangle,
+                                                   {0, 0, 0.1})));
+    CHECK_GT(detail::signed_overlap_volume(sphere, triangle, {0, 0, -0.1}),
+             0.0);
+  }
+}
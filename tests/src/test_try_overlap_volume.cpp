@@ -0,0 +1,79 @@
+// Copyright (C) 2026 Severin Strobl <git@severin-strobl.de>
+//
+// SPDX-License-Identifier: MIT
+//
+// Exact calculation of the overlap volume of spheres and mesh elements.
+// http://dx.doi.org/10.1016/j.jcp.2016.02.003
+
+#include "common.hpp"
+
+#include "overlap/overlap.hpp"
+
+#include <vector>
+
+TEST_SUITE("TryOverlapVolume") {
+  using namespace overlap;
+
+  const auto hex = unit_hexahedron();
+
+  // hexahedron with a displaced vertex, resulting in non-planar faces
+  const auto distorted_hex = []() {
+    auto vertices = unit_hexahedron().vertices;
+    vertices[6] += Vector{0.001, 0.001, 0.001};
+
+    return Hexahedron{vertices};
+  }();
+
+  TEST_CASE("Validate") {
+    CHECK_EQ(validate(hex), OverlapStatus::success);
+    CHECK_EQ(validate(distorted_hex), OverlapStatus::non_planar_face);
+  }
+
+  TEST_CASE("NonThrowing") {
+    const auto sphere = Sphere{{1, 1, 1}, 0.5};
+
+    const auto volume = try_overlap_volume(sphere, hex);
+    REQUIRE(volume.has_value());
+    CHECK_EQ(*volume, overlap_volume(sphere, hex));
+    CHECK_EQ(overlap_volume_unchecked(sphere, hex), *volume);
+
+    CHECK_FALSE(try_overlap_volume(sphere, distorted_hex).has_value());
+
+    // disjoint and contained configurations are resolved without validation
+    CHECK_EQ(try_overlap_volume(Sphere{{5, 0, 0}, 1}, distorted_hex), 0.0);
+
+    const auto large = Sphere{{0, 0, 0}, 3};
+    CHECK_EQ(try_overlap_volume(large, distorted_hex),
+             overlap_volume(large, distorted_hex));
+  }
+
+  TEST_CASE("PyramidApex") {
+    // the apex inside of the sphere requires the decomposition into tetrahedra
+    const auto pyramid = Pyramid{
+        {{{-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1}, {0, 0, 1}}}};
+    const auto sphere = Sphere{{0, 0, 0.5}, 1};
+
+    const auto volume = try_overlap_volume(sphere, pyramid);
+    REQUIRE(volume.has_value());
+    CHECK_EQ(*volume, Approx(overlap_volume(sphere, pyramid)));
+    CHECK_EQ(overlap_volume_unchecked(sphere, pyramid), Approx(*volume));
+  }
+
+  TEST_CASE("Pairs") {
+    const auto spheres =
+        std::vector<Sphere>{Sphere{{1, 1, 1}, 0.5}, Sphere{{-1, 0, 0}, 0.75}};
+    const auto elements = std::vector<Hexahedron>{hex, distorted_hex, hex};
+    const auto pairs = std::vector<SphereElementPair>{
+        {0, 0}, {0, 1}, {1, 2}, {1, 1}};
+
+    const auto result = try_overlap_volume_pairs(spheres, elements, pairs);
+
+    REQUIRE_EQ(result.volumes.size(), pairs.size());
+    CHECK_EQ(result.volumes[0], overlap_volume(spheres[0], hex));
+    CHECK_EQ(result.volumes[1], 0.0);
+    CHECK_EQ(result.volumes[2], overlap_volume(spheres[1], hex));
+    CHECK_EQ(result.volumes[3], 0.0);
+
+    CHECK((result.failed_elements == std::vector<std::size_t>{1}));
+  }
+}